@@ -417,6 +417,11 @@ private:
   su2double *WeightsIntegrationADER_DG;     /*!< \brief The weights of the ADER-DG time integration points on the interval [-1,1]. */
   unsigned short nRKStep;                   /*!< \brief Number of steps of the explicit Runge-Kutta method. */
   su2double *RK_Alpha_Step;                 /*!< \brief Runge-Kutta beta coefficients. */
+  unsigned short Kind_LowStorageRK;         /*!< \brief Low-storage Runge-Kutta scheme. */
+  unsigned short nLowStorageRKStep;         /*!< \brief Number of stages of the low-storage Runge-Kutta scheme. */
+  su2double LowStorageRK_Coeff[5][3];       /*!< \brief Coefficients (A, B, a) of each stage of the low-storage Runge-Kutta scheme. */
+  su2double ResSmoothing_Coeff;             /*!< \brief Coefficient of the implicit residual smoothing (0 disables it). */
+  unsigned short ResSmoothing_Iter;         /*!< \brief Number of Jacobi sweeps of the implicit residual smoothing. */
 
   unsigned short nQuasiNewtonSamples;  /*!< \brief Number of samples used in quasi-Newton solution methods. */
   bool UseVectorization;       /*!< \brief Whether to use vectorized numerics schemes. */
@@ -451,6 +456,9 @@ private:
   string *TagFFDBox;                  /*!< \brief Tag of the FFD box. */
   unsigned short GeometryMode;        /*!< \brief Gemoetry mode (analysis or gradient computation). */
   unsigned short MGCycle;             /*!< \brief Kind of multigrid cycle. */
+  bool Multigrid_Turb;                /*!< \brief Solve the turbulence model with the multigrid of the flow. */
+  bool MG_QualityAgglomeration;       /*!< \brief Agglomerate partition interfaces as interior points, and directionally in stretched regions. */
+  su2double MG_DirectionalRatio;      /*!< \brief Anisotropy of the coupling above which the agglomeration is directional. */
   unsigned short FinestMesh;          /*!< \brief Finest mesh for the full multigrid approach. */
   unsigned short nFFD_Fix_IDir,
   nFFD_Fix_JDir, nFFD_Fix_KDir;       /*!< \brief Number of planes fixed in the FFD. */
@@ -575,9 +583,20 @@ private:
   su2double Linear_Solver_Smoother_Relaxation;   /*!< \brief Relaxation factor for iterative linear smoothers. */
   unsigned long Linear_Solver_Iter;              /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
+  unsigned long Deform_Linear_Solver_Prec_Reuse; /*!< \brief Reuse the deformation preconditioner while the linear solver needs at most these iterations. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  unsigned short Linear_Solver_Recycle_Size;     /*!< \brief Max number of directions recycled across linear solves (RECYCLING_GCRO). */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool Linear_Solver_ILU_Levels;                 /*!< \brief Level-scheduled (instead of partitioned) thread-parallel ILU. */
+  bool Linear_Solver_ILU_InPlace;                /*!< \brief ILU(0) factorization overwrites the matrix (single sweep smoother). */
+  bool NewtonKrylov;                             /*!< \brief Jacobian-free Newton-Krylov iterations for steady compressible flows. */
+  su2double NewtonKrylov_CFL;                    /*!< \brief CFL above which the Newton iterations are used. */
+  unsigned long NewtonKrylov_Iter;               /*!< \brief Max Krylov iterations per Newton step. */
+  su2double NewtonKrylov_Tol;                    /*!< \brief Relative tolerance of the Newton steps. */
+  su2double NewtonKrylov_Eps;                    /*!< \brief Scale of the finite difference step of the Jacobian-vector products. */
+  unsigned long Jacobian_Reuse_Freq;             /*!< \brief Max number of iterations between assemblies of the flow Jacobian. */
+  su2double Jacobian_Reuse_Factor;               /*!< \brief Growth of the linear iterations (w.r.t. a fresh Jacobian) that forces a new assembly. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -609,11 +628,15 @@ private:
   Max_Beta_RoeTurkel;               /*!< \brief Maximum value of Beta for the Roe-Turkel low Mach preconditioner. */
   unsigned long GridDef_Nonlinear_Iter;  /*!< \brief Number of nonlinear increments for grid deformation. */
   unsigned short Deform_StiffnessType;   /*!< \brief Type of element stiffness imposed for FEA mesh deformation. */
+  unsigned short Deform_Method;          /*!< \brief Method used to propagate the surface displacements to the volume. */
+  unsigned long Deform_IDW_Neighbors;    /*!< \brief Number of nearest boundary points used by the inverse distance weighting. */
+  su2double Deform_IDW_Exponent;         /*!< \brief Exponent of the inverse distance weights. */
   bool Deform_Mesh;                      /*!< \brief Determines whether the mesh will be deformed. */
   bool Deform_Output;                    /*!< \brief Print the residuals during mesh deformation to the console. */
   su2double Deform_Tol_Factor;       /*!< \brief Factor to multiply smallest volume for deform tolerance (0.001 default) */
   su2double Deform_Coeff;            /*!< \brief Deform coeffienct */
   su2double Deform_Limit;            /*!< \brief Deform limit */
+  su2double WallDistance_UpdateTol;  /*!< \brief Relative tolerance for the incremental update of the wall distance. */
   unsigned short FFD_Continuity;     /*!< \brief Surface continuity at the intersection with the FFD */
   unsigned short FFD_CoordSystem;    /*!< \brief Define the coordinates system */
   su2double Deform_ElasticityMod,    /*!< \brief Young's modulus for volume deformation stiffness model */
@@ -995,6 +1018,8 @@ private:
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
+  su2double RadialBasisFunction_GreedyTol;   /*!< \brief Tolerance on the power function for the greedy selection of RBF centers. */
+  unsigned long RadialBasisFunction_MaxCenters; /*!< \brief Maximum number of RBF centers selected by the greedy algorithm. */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -2678,6 +2703,23 @@ public:
    */
   unsigned short GetMGCycle(void) const { return MGCycle; }
 
+  /*!
+   * \brief Get whether the turbulence model is also solved with the FAS multigrid.
+   * \return <code>TRUE</code> if the turbulence equations use the multigrid levels of the flow.
+   */
+  bool GetMultigrid_Turb(void) const { return Multigrid_Turb; }
+
+  /*!
+   * \brief Get whether the quality-aware agglomeration is used to build the multigrid levels.
+   * \return <code>TRUE</code> to agglomerate partition interfaces as interior points, and directionally in stretched regions.
+   */
+  bool GetMG_QualityAgglomeration(void) const { return MG_QualityAgglomeration; }
+
+  /*!
+   * \brief Get the anisotropy (ratio of the max. to min. coupling of a point) above which the agglomeration is directional.
+   */
+  su2double GetMG_DirectionalRatio(void) const { return MG_DirectionalRatio; }
+
   /*!
    * \brief Get the king of evaluation in the geometrical module.
    * \return 0 or 1 depending of we are dealing with a V or W cycle.
@@ -2802,6 +2844,12 @@ public:
    */
   unsigned short GetnRKStep(void) const { return nRKStep; }
 
+  /*!
+   * \brief Get the number of stages of the low-storage Runge-Kutta scheme.
+   * \return Number of stages.
+   */
+  unsigned short GetnLowStorageRKStep(void) const { return nLowStorageRKStep; }
+
   /*!
    * \brief Get the number of time levels for time accurate local time stepping.
    * \return Number of time levels.
@@ -3217,6 +3265,26 @@ public:
    */
   su2double Get_Alpha_RKStep(unsigned short val_step) const { return RK_Alpha_Step[val_step]; }
 
+  /*!
+   * \brief Get the coefficients of a stage of the low-storage Runge-Kutta scheme, the update
+   *        of the stage is U = a*U^n + (1-a)*U + B*S, with S = A*S - dt*R(U).
+   * \param[in] val_step - Index of the stage.
+   * \return Coefficients A, B, and a.
+   */
+  const su2double* Get_LowStorageRK_Coeff(unsigned short val_step) const { return LowStorageRK_Coeff[val_step]; }
+
+  /*!
+   * \brief Get the coefficient of the implicit residual smoothing of the explicit schemes.
+   * \return Smoothing coefficient, 0 if the smoothing is not used.
+   */
+  su2double GetResSmoothing_Coeff(void) const { return ResSmoothing_Coeff; }
+
+  /*!
+   * \brief Get the number of Jacobi sweeps of the implicit residual smoothing.
+   * \return Number of sweeps.
+   */
+  unsigned short GetResSmoothing_Iter(void) const { return ResSmoothing_Iter; }
+
   /*!
    * \brief Get the index of the surface defined in the geometry file.
    * \param[in] val_marker - Value of the marker in which we are interested.
@@ -4083,18 +4151,84 @@ public:
    */
   unsigned long GetDeform_Linear_Solver_Iter(void) const { return Deform_Linear_Solver_Iter; }
 
+  /*!
+   * \brief Get the threshold of linear iterations under which the mesh deformation preconditioner is reused.
+   * \return Max number of linear iterations with a reused preconditioner (0 means always rebuild).
+   */
+  unsigned long GetDeform_Linear_Solver_Prec_Reuse(void) const { return Deform_Linear_Solver_Prec_Reuse; }
+
   /*!
    * \brief Get the ILU fill-in level for the linear solver.
    * \return Fill in level of the ILU preconditioner for the linear solver.
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get whether the ILU factorization and sweeps are parallelized by level scheduling.
+   * \return <code>TRUE</code> for level scheduling, <code>FALSE</code> for per-thread partitions.
+   */
+  bool GetLinear_Solver_ILU_Levels(void) const { return Linear_Solver_ILU_Levels; }
+
+  /*!
+   * \brief Get whether the ILU(0) factorization of the finite volume matrices is computed in place.
+   * \return <code>TRUE</code> to overwrite the matrix with its factors (no separate ILU matrix).
+   */
+  bool GetLinear_Solver_ILU_InPlace(void) const { return Linear_Solver_ILU_InPlace; }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void) const { return Linear_Solver_Restart_Frequency; }
 
+  /*!
+   * \brief Get the max number of directions recycled across linear solves.
+   * \return Size of the recycled subspace of the RECYCLING_GCRO linear solver.
+   */
+  unsigned short GetLinear_Solver_Recycle_Size(void) const { return Linear_Solver_Recycle_Size; }
+
+  /*!
+   * \brief Get whether the Jacobian-free Newton-Krylov iterations are enabled.
+   * \return <code>TRUE</code> for Newton-Krylov iterations of steady compressible flows.
+   */
+  bool GetNewtonKrylov(void) const { return NewtonKrylov; }
+
+  /*!
+   * \brief Get the CFL number above which the Newton iterations replace the pseudo-time steps.
+   * \return CFL threshold (applied to the smallest local CFL if adaptive).
+   */
+  su2double GetNewtonKrylov_CFL(void) const { return NewtonKrylov_CFL; }
+
+  /*!
+   * \brief Get the maximum number of Krylov iterations per Newton step.
+   * \return Max number of iterations.
+   */
+  unsigned long GetNewtonKrylov_Iter(void) const { return NewtonKrylov_Iter; }
+
+  /*!
+   * \brief Get the relative tolerance of the (inexact) Newton steps.
+   * \return Reduction of the linear residual in each Newton step.
+   */
+  su2double GetNewtonKrylov_Tol(void) const { return NewtonKrylov_Tol; }
+
+  /*!
+   * \brief Get the scale of the finite difference step of the Jacobian-vector products.
+   * \return Scale factor of the step.
+   */
+  su2double GetNewtonKrylov_Eps(void) const { return NewtonKrylov_Eps; }
+
+  /*!
+   * \brief Get the max number of implicit iterations between assemblies of the flow Jacobian.
+   * \return Refresh frequency of the Jacobian and of its preconditioner (1 assembles every iteration).
+   */
+  unsigned long GetJacobian_Reuse_Freq(void) const { return Jacobian_Reuse_Freq; }
+
+  /*!
+   * \brief Get the factor that triggers an early refresh of a reused Jacobian.
+   * \return Max ratio between the linear iterations with the lagged and with the fresh Jacobian.
+   */
+  su2double GetJacobian_Reuse_Factor(void) const { return Jacobian_Reuse_Factor; }
+
   /*!
    * \brief Get the relaxation factor for iterative linear smoothers.
    * \return Relaxation factor.
@@ -4224,6 +4358,12 @@ public:
    */
   su2double GetDeform_Limit(void) const { return Deform_Limit; }
 
+  /*!
+   * \brief Get the relative tolerance for the incremental update of the wall distance.
+   * \return Tolerance, 0 means that the wall distance is always recomputed from scratch.
+   */
+  su2double GetWallDistance_UpdateTol(void) const { return WallDistance_UpdateTol; }
+
   /*!
    * \brief Get Young's modulus for deformation (constant stiffness deformation)
    */
@@ -4241,6 +4381,21 @@ public:
    */
   unsigned short GetDeform_Stiffness_Type(void) const { return Deform_StiffnessType; }
 
+  /*!
+   * \brief Get the method used to propagate the surface displacements to the volume mesh.
+   */
+  unsigned short GetDeform_Method(void) const { return Deform_Method; }
+
+  /*!
+   * \brief Get the number of nearest boundary points used by the inverse distance weighting deformation.
+   */
+  unsigned long GetDeform_IDW_Neighbors(void) const { return Deform_IDW_Neighbors; }
+
+  /*!
+   * \brief Get the exponent of the weights of the inverse distance weighting deformation.
+   */
+  su2double GetDeform_IDW_Exponent(void) const { return Deform_IDW_Exponent; }
+
   /*!
    * \brief Get the size of the layer of highest stiffness for wall distance-based mesh stiffness.
    */
@@ -8806,6 +8961,16 @@ public:
    */
   su2double GetRadialBasisFunctionPruneTol(void) const { return RadialBasisFunction_PruneTol; }
 
+  /*!
+   * \brief Get the tolerance on the power function for the greedy selection of RBF centers (0 means all donors are used).
+   */
+  su2double GetRadialBasisFunctionGreedyTol(void) const { return RadialBasisFunction_GreedyTol; }
+
+  /*!
+   * \brief Get the maximum number of RBF centers selected by the greedy algorithm (0 means no limit).
+   */
+  unsigned long GetRadialBasisFunctionMaxCenters(void) const { return RadialBasisFunction_MaxCenters; }
+
   /*!
    * \brief Get the number of donor points to use in Nearest Neighbor interpolation.
    */
@@ -30,6 +30,7 @@
 #include "./CADTBaseClass.hpp"
 #include "./CBBoxTargetClass.hpp"
 #include "../omp_structure.hpp"
+#include "../containers/C2DContainer.hpp"
 
 /*!
  * \class CADTElemClass
@@ -128,10 +129,83 @@ public:
                                       unsigned long   &elemID,
                                       int             &rankID) {
     const auto iThread = omp_get_thread_num();
+    unsigned long iElemADT = localElemIDs.size();
     DetermineNearestElement_impl(BBoxTargets[iThread], FrontLeaves[iThread],
-              FrontLeavesNew[iThread], coor, dist, markerID, elemID, rankID);
+              FrontLeavesNew[iThread], coor, iElemADT, dist, markerID, elemID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the nearest element in the ADT for the given coordinate,
+   *        starting from a guess for the nearest element, e.g. the result of a previous search.
+   *        The guess reduces the search radius, the result is identical to the search without guess.
+   * \param[in]     coor     Coordinate for which the nearest element in the ADT must be determined.
+   * \param[in,out] iElemADT On input the index in the ADT of the guess, no guess is used if it is
+   *                         not less than the number of elements. On output the index of the nearest element.
+   * \param[out]    dist     Distance to the nearest element in the ADT.
+   * \param[out]    markerID Local marker ID of the nearest element in the ADT.
+   * \param[out]    elemID   Local element ID of the nearest element in the ADT.
+   * \param[out]    rankID   Rank on which the nearest element in the ADT is stored.
+   */
+  inline void DetermineNearestElement(const su2double *coor,
+                                      unsigned long   &iElemADT,
+                                      su2double       &dist,
+                                      unsigned short  &markerID,
+                                      unsigned long   &elemID,
+                                      int             &rankID) {
+    const auto iThread = omp_get_thread_num();
+    DetermineNearestElement_impl(BBoxTargets[iThread], FrontLeaves[iThread],
+              FrontLeavesNew[iThread], coor, iElemADT, dist, markerID, elemID, rankID);
+  }
+
+  /*!
+   * \brief Function, which computes the distance of the given coordinate to an element of the ADT.
+   * \param[in]  coor     Coordinate for which the distance must be determined.
+   * \param[in]  iElemADT Index of the element in the ADT.
+   * \param[out] dist     Distance to the element.
+   * \param[out] markerID Local marker ID of the element.
+   * \param[out] elemID   Local element ID of the element.
+   * \param[out] rankID   Rank on which the element is stored.
+   */
+  inline void DistanceToElement(const su2double     *coor,
+                                const unsigned long iElemADT,
+                                su2double           &dist,
+                                unsigned short      &markerID,
+                                unsigned long       &elemID,
+                                int                 &rankID) const {
+    Dist2ToElement(iElemADT, coor, dist);
+    dist     = sqrt(dist);
+    markerID = localMarkers[iElemADT];
+    elemID   = localElemIDs[iElemADT];
+    rankID   = ranksOfElems[iElemADT];
+  }
+
+  /*!
+   * \brief Get the number of elements stored in the ADT.
+   * \return The number of elements.
+   */
+  inline unsigned long GetnElem(void) const { return localElemIDs.size(); }
+
+  /*!
+   * \brief Function, which determines the nearest elements in the ADT for a batch of coordinates.
+   * \note The coordinates are processed in a space filling curve order, such that consecutive
+   *       searches of a thread traverse similar parts of the tree and the result of the previous
+   *       search is a good initial guess. The work is distributed over the OpenMP threads, this
+   *       function must be called outside of parallel regions.
+   * \param[in]     coor     Coordinates (one point per row) for which the nearest elements are determined.
+   * \param[in,out] iElemADT Indices in the ADT of the nearest elements, on input they are used as initial
+   *                         guess (see DetermineNearestElement), it is resized if its size does not match.
+   * \param[out]    dist     Distances to the nearest elements.
+   * \param[out]    markerID Local marker IDs of the nearest elements.
+   * \param[out]    elemID   Local element IDs of the nearest elements.
+   * \param[out]    rankID   Ranks on which the nearest elements are stored.
+   */
+  void DetermineNearestElements(const su2activematrix  &coor,
+                                vector<unsigned long>  &iElemADT,
+                                vector<su2double>      &dist,
+                                vector<unsigned short> &markerID,
+                                vector<unsigned long>  &elemID,
+                                vector<int>            &rankID);
+
 private:
   /*!
    * \brief Implementation of DetermineContainingElement.
@@ -154,6 +228,7 @@ private:
                                     vector<unsigned long>& frontLeaves,
                                     vector<unsigned long>& frontLeavesNew,
                                     const su2double *coor,
+                                    unsigned long   &iElemADT,
                                     su2double       &dist,
                                     unsigned short  &markerID,
                                     unsigned long   &elemID,
@@ -333,6 +408,20 @@ private:
   void Dist2ToElement(const unsigned long elemID,
                       const su2double     *coor,
                       su2double           &dist2Elem) const;
+
+  /*!
+   * \brief Function, which computes the distance squared of the given coordinate to
+            a group of line (2D) or triangular (3D) elements. The elements are processed
+            simultaneously by a branch free version of Dist2ToLine and Dist2ToTriangle.
+   * \param[in]  nElem   Number of elements in the group, at most the SIMD length.
+   * \param[in]  elemIDs IDs of the elements to which the distance must be determined.
+   * \param[in]  coor    Coordinate for which the distance to the elements must be determined.
+   * \param[out] dist2   Distances squared from the coordinate to the elements.
+   */
+  void Dist2ToSimplices(const unsigned short nElem,
+                        const unsigned long  *elemIDs,
+                        const su2double      *coor,
+                        su2double            *dist2) const;
   /*!
    * \brief Function, which computes the distance squared of the given coordinate
             to a linear line element.
@@ -75,6 +75,26 @@ public:
                               coor, dist, pointID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the nNodes nearest nodes in the ADT for the given coordinate.
+   * \note This simply forwards the call to the implementation function selecting the right
+   *       working variables for the current thread.
+   * \param[in]  coor    Coordinate for which the nearest nodes in the ADT must be determined.
+   * \param[in]  nNodes  Number of nearest nodes to be determined.
+   * \param[out] dist    Distances to the nearest nodes, sorted in increasing order.
+   * \param[out] pointID Local point IDs of the nearest nodes.
+   * \param[out] rankID  Ranks on which the nearest nodes are stored.
+   */
+  inline void DetermineNearestNodes(const su2double     *coor,
+                                    const unsigned long nNodes,
+                                    vector<su2double>     &dist,
+                                    vector<unsigned long> &pointID,
+                                    vector<int>           &rankID) {
+    const auto iThread = omp_get_thread_num();
+    DetermineNearestNodes_impl(FrontLeaves[iThread], FrontLeavesNew[iThread],
+                               coor, nNodes, dist, pointID, rankID);
+  }
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -91,4 +111,16 @@ private:
                                  su2double       &dist,
                                  unsigned long   &pointID,
                                  int             &rankID) const;
+
+  /*!
+   * \brief Implementation of DetermineNearestNodes.
+   * \note Working variables (first two) passed explicitly for thread safety.
+   */
+  void DetermineNearestNodes_impl(vector<unsigned long>& frontLeaves,
+                                  vector<unsigned long>& frontLeavesNew,
+                                  const su2double       *coor,
+                                  const unsigned long   nNodes,
+                                  vector<su2double>     &dist,
+                                  vector<unsigned long> &pointID,
+                                  vector<int>           &rankID) const;
 };
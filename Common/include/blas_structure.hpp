@@ -146,5 +146,49 @@ private:
    */
   void gemm_arbitrary(int m, int n, int k, const su2double *a, int lda,
                       const su2double *b, int ldb, su2double *c, int ldc);
+
+  /*!
+   * \brief Function, which carries out the matrix product for the small matrices
+            encountered in the DG solver. The matrices are stored in row major
+            order and the columns of b and c are processed with simd::Array
+            registers, such that the batch of elements stored in the columns
+            is treated in one call.
+   * \param[in]  m  - Number of rows of a and c.
+   * \param[in]  n  - Number of columns of b and c.
+   * \param[in]  k  - Number of columns of a and number of rows of b.
+   * \param[in]  a  - Input matrix in the multiplication.
+   * \param[in]  b  - Input matrix in the multiplication.
+   * \param[out] c  - Result of the matrix product a*b.
+   */
+  void gemm_small(const int m,        const int n,        const int k,
+                  const su2double *a, const su2double *b, su2double *c);
+
+  /*!
+   * \brief Function, which computes a strip of NB simd::Array widths of columns
+            of c for all the m rows.
+   * \param[in]  m   - Number of rows of a and c.
+   * \param[in]  ldc - Leading dimension of b and c.
+   * \param[in]  k   - Number of columns of a and number of rows of b.
+   * \param[in]  a   - Input matrix in the multiplication.
+   * \param[in]  b   - Pointer to the first column of the strip of b.
+   * \param[out] c   - Pointer to the first column of the strip of c.
+   */
+  template<int NB>
+  void gemm_small_strip(const int m,        const int ldc,      const int k,
+                        const su2double *a, const su2double *b, su2double *c);
+
+  /*!
+   * \brief Register blocked kernel of gemm_small, which computes MB rows and
+            NB simd::Array widths of columns of c. The block sizes are template
+            parameters, such that all loops, except the one over k, are unrolled.
+   * \param[in]  ldc - Leading dimension of b and c.
+   * \param[in]  k   - Number of columns of a and number of rows of b.
+   * \param[in]  a   - Pointer to the first row of the block of a.
+   * \param[in]  b   - Pointer to the first column of the block of b.
+   * \param[out] c   - Pointer to the first entry of the block of c.
+   */
+  template<int MB, int NB>
+  void gemm_small_kernel(const int ldc,      const int k,        const su2double *a,
+                         const su2double *b, su2double *c);
 #endif
 };
@@ -1230,8 +1230,11 @@ protected:
    * \brief Set the wall distance based on an previously constructed ADT
    * \param[in] config - Definition of the particular problem.
    * \param[in] WallADT - The ADT to compute the wall distance
+   * \param[in] iZoneADT - Zone of the walls stored in the ADT.
+   * \param[in] maxWallDisp - Maximum wall displacement since the last full computation, negative for a full computation.
    */
-  void SetWallDistance(const CConfig *config, CADTElemClass* WallADT) override;
+  void SetWallDistance(const CConfig *config, CADTElemClass* WallADT,
+                       unsigned short iZoneADT, su2double maxWallDisp) override;
 };
 
 /*!
@@ -36,6 +36,8 @@
 
 using namespace std;
 
+class CBlasStructure;
+
 /*!
  * \class CFEMStandardElementBase
  * \brief Base class for a FEM standard element.
@@ -841,6 +843,16 @@ private:
                                                           Used for plotting. */
   vector<unsigned short> subConn2ForPlotting; /*!< \brief Local subconnectivity of element type 2 of the high order element.
                                                           Used for plotting. */
+
+  bool sumFactorization;           /*!< \brief Whether or not the tensor product structure of the basis functions and
+                                               integration points is exploited (quadrilaterals and hexahedra). */
+  unsigned short nDOFs1D;          /*!< \brief Number of DOFs in one parametric direction, if sumFactorization. */
+  unsigned short nIntegration1D;   /*!< \brief Number of integration points in one parametric direction, if sumFactorization. */
+
+  vector<su2double> lagBasisInt1D;         /*!< \brief 1D Lagrangian basis functions in the 1D integration points. */
+  vector<su2double> derLagBasisInt1D;      /*!< \brief Derivatives of the 1D Lagrangian basis functions in the 1D integration points. */
+  vector<su2double> lagBasisInt1DTrans;    /*!< \brief Transpose of lagBasisInt1D. */
+  vector<su2double> derLagBasisInt1DTrans; /*!< \brief Transpose of derLagBasisInt1D. */
 public:
   /*!
   * \brief Alternative constructor.
@@ -1103,7 +1115,130 @@ public:
   */
   su2double WorkEstimateMetis(CConfig *config);
 
+  /*!
+  * \brief Function, which indicates whether or not sum factorization is used for this standard element.
+           Note that only the volume residual of the DG solvers uses the sum factorization functions,
+           the ADER-DG predictor and the surface residuals still use the dense matrix products.
+  * \return  True for quadrilaterals and hexahedra of degree 2 and higher, false otherwise.
+  */
+  inline bool GetSumFactorization(void) const {return sumFactorization;}
+
+  /*!
+  * \brief Function, which makes available the size of the work array needed by the
+           sum factorization functions per column of the data, i.e. per unit of N.
+  * \return  The size of the work array per column, zero if sum factorization is not used.
+  */
+  unsigned int GetSizeWorkSumFactorization(void) const;
+
+  /*!
+  * \brief Function, which interpolates the data in the DOFs to the integration points,
+           i.e. the product of GetBasisFunctionsIntegration() and dataDOFs. For quadrilaterals
+           and hexahedra sum factorization is used, otherwise a gemm call.
+  * \param[in]  N        - Number of columns of dataDOFs and dataInt.
+  * \param[in]  dataDOFs - Data in the DOFs, row major order.
+  * \param[out] dataInt  - Data in the integration points, row major order.
+  * \param[in]  work     - Work array of size N*GetSizeWorkSumFactorization().
+  * \param[in]  blas     - Object to carry out the matrix products.
+  * \param[in]  config   - Object, which contains the input parameters (profiling).
+  */
+  void InterpolateDOFsToIntegrationPoints(const int       N,
+                                          const su2double *dataDOFs,
+                                          su2double       *dataInt,
+                                          su2double       *work,
+                                          CBlasStructure  *blas,
+                                          const CConfig   *config) const;
+
+  /*!
+  * \brief Function, which computes the data and its parametric derivatives in the
+           integration points, i.e. the product of GetMatBasisFunctionsIntegration()
+           and dataDOFs. For quadrilaterals and hexahedra sum factorization is used.
+  * \param[in]  N        - Number of columns of dataDOFs and dataInt.
+  * \param[in]  dataDOFs - Data in the DOFs, row major order.
+  * \param[out] dataInt  - Data and its r-, s- and t-derivatives in the integration points.
+  * \param[in]  work     - Work array of size N*GetSizeWorkSumFactorization().
+  * \param[in]  blas     - Object to carry out the matrix products.
+  * \param[in]  config   - Object, which contains the input parameters (profiling).
+  */
+  void DataAndDerivativesIntegrationPoints(const int       N,
+                                           const su2double *dataDOFs,
+                                           su2double       *dataInt,
+                                           su2double       *work,
+                                           CBlasStructure  *blas,
+                                           const CConfig   *config) const;
+
+  /*!
+  * \brief Function, which integrates the data in the integration points against the
+           basis functions, i.e. the product of GetBasisFunctionsIntegrationTrans() and
+           dataInt. For quadrilaterals and hexahedra sum factorization is used.
+  * \param[in]  N        - Number of columns of dataInt and dataDOFs.
+  * \param[in]  dataInt  - Data in the integration points, row major order.
+  * \param[out] dataDOFs - Result in the DOFs, row major order.
+  * \param[in]  work     - Work array of size N*GetSizeWorkSumFactorization().
+  * \param[in]  blas     - Object to carry out the matrix products.
+  * \param[in]  config   - Object, which contains the input parameters (profiling).
+  */
+  void IntegrateDataIntegrationPoints(const int       N,
+                                      const su2double *dataInt,
+                                      su2double       *dataDOFs,
+                                      su2double       *work,
+                                      CBlasStructure  *blas,
+                                      const CConfig   *config) const;
+
+  /*!
+  * \brief Function, which integrates the parametric fluxes in the integration points
+           against the derivatives of the basis functions, i.e. the product of
+           GetDerMatBasisFunctionsIntTrans() and fluxes. For quadrilaterals and
+           hexahedra sum factorization is used.
+  * \param[in]  N        - Number of columns of fluxes and res.
+  * \param[in]  fluxes   - Fluxes in the integration points, the nDim parametric fluxes
+                           of an integration point are stored consecutively.
+  * \param[out] res      - Residual in the DOFs, row major order.
+  * \param[in]  work     - Work array of size N*GetSizeWorkSumFactorization().
+  * \param[in]  blas     - Object to carry out the matrix products.
+  * \param[in]  config   - Object, which contains the input parameters (profiling).
+  */
+  void IntegrateFluxesIntegrationPoints(const int       N,
+                                        const su2double *fluxes,
+                                        su2double       *res,
+                                        su2double       *work,
+                                        CBlasStructure  *blas,
+                                        const CConfig   *config) const;
+
 private:
+  /*!
+  * \brief Function, which creates the 1D data needed for sum factorization,
+           if the element is a quadrilateral or a hexahedron.
+  */
+  void SetUpSumFactorization(void);
+
+  /*!
+  * \brief Function, which applies a tensor product of 1D matrices to the data
+           using sum factorization. The 1D matrices are stored in row major order
+           and have the dimensions nOut1D x nIn1D.
+  * \param[in]  N      - Number of columns of the data.
+  * \param[in]  nIn1D  - Number of input points in one direction.
+  * \param[in]  nOut1D - Number of output points in one direction.
+  * \param[in]  Ar     - 1D matrix applied in r-direction.
+  * \param[in]  As     - 1D matrix applied in s-direction.
+  * \param[in]  At     - 1D matrix applied in t-direction, only for hexahedra.
+  * \param[in]  dataIn - Input data, with the r-index running fastest.
+  * \param[out] dataOut- Output data, with the r-index running fastest.
+  * \param[in]  work   - Work array.
+  * \param[in]  blas   - Object to carry out the matrix products.
+  * \param[in]  config - Object, which contains the input parameters (profiling).
+  */
+  void TensorProductSumFact(const int       N,
+                            const int       nIn1D,
+                            const int       nOut1D,
+                            const su2double *Ar,
+                            const su2double *As,
+                            const su2double *At,
+                            const su2double *dataIn,
+                            su2double       *dataOut,
+                            su2double       *work,
+                            CBlasStructure  *blas,
+                            const CConfig   *config) const;
+
   /*!
   * \brief Function, which changes the given quadrilateral connectivity, such that the direction coincides
            with the direction corresponding to corner vertices vert0, vert1, vert2, vert3.
@@ -805,6 +805,12 @@ public:
    */
   inline virtual void SetCoord(CGeometry *geometry) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetHaloControlVolume(const CConfig *config) {}
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1697,8 +1703,26 @@ public:
    * \brief Set the wall distance based on an previously constructed ADT
    * \param[in] config - Definition of the particular problem.
    * \param[in] WallADT - The ADT to compute the wall distance
+   * \param[in] iZoneADT - Zone of the walls stored in the ADT.
+   * \param[in] maxWallDisp - Maximum wall displacement since the last full computation, negative for a full computation.
+   */
+  virtual void SetWallDistance(const CConfig *config, CADTElemClass* WallADT,
+                               unsigned short iZoneADT, su2double maxWallDisp) {}
+
+  /*!
+   * \brief Compute the maximum displacement of the viscous walls since the last full wall distance computation.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] maxWallDisp - Local maximum displacement.
+   * \return False if there is no reference for an incremental update.
+   */
+  virtual bool GetMaxWallDisplacement(const CConfig *config, su2double &maxWallDisp) const { return false; }
+
+  /*!
+   * \brief Store (or invalidate) the reference for the incremental update of the wall distance.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] maxWallDisp - Value used in the last update, negative for a full computation.
    */
-  virtual void SetWallDistance(const CConfig *config, CADTElemClass* WallADT) {}
+  virtual void UpdateWallDistanceReference(const CConfig *config, su2double maxWallDisp) {}
 
   /*!
    * \brief Set wall distances a specific value
@@ -37,6 +37,17 @@
  */
 class CMultiGridGeometry final : public CGeometry {
 
+private:
+  vector<su2double> StrongCoupling; /*!< \brief Coupling that the neighbors of each fine point need to be agglomerated with it (0 if isotropic). */
+
+  /*!
+   * \brief Strength of the coupling between a point and a neighbor (face area over edge length).
+   * \param[in] iPoint - Point.
+   * \param[in] iNeigh - Local index of the neighbor of the point.
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   */
+  su2double CouplingWeight(unsigned long iPoint, unsigned short iNeigh, const CGeometry *fine_grid) const;
+
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetVertex;
@@ -82,6 +93,40 @@ public:
   void SetSuitableNeighbors(vector<unsigned long> *Suitable_Indirect_Neighbors, unsigned long iPoint,
                             unsigned long Index_CoarseCV, CGeometry *fine_grid);
 
+  /*!
+   * \brief Compute the coupling that the neighbors of the anisotropic points need to be agglomerated
+   *        with them (directional agglomeration), the points are processed in parallel.
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetDirectionalCoupling(const CGeometry *fine_grid, const CConfig *config);
+
+  /*!
+   * \brief Determine if a neighbor is coupled strongly enough with a point to be agglomerated with it.
+   * \param[in] iPoint - Seed point.
+   * \param[in] iNeigh - Local index of the neighbor of the seed.
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \return <code>TRUE</code> if the neighbor can be agglomerated (always if both points are isotropic).
+   */
+  bool DirectionalCheck(unsigned long iPoint, unsigned short iNeigh, const CGeometry *fine_grid) const;
+
+  /*!
+   * \brief Determine if a point is isotropic, only those use indirect neighbors.
+   * \param[in] iPoint - Point.
+   */
+  inline bool IsotropicCheck(unsigned long iPoint) const {
+    return StrongCoupling.empty() || (StrongCoupling[iPoint] == 0.0);
+  }
+
+  /*!
+   * \brief Determine if a boundary point is only on partition interfaces, in which case it is agglomerated
+   *        as an interior point (when the quality-aware agglomeration is used).
+   * \param[in] iPoint - Point.
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  bool InterfaceCheck(unsigned long iPoint, const CGeometry *fine_grid, const CConfig *config) const;
+
   /*!
    * \brief Set boundary vertex.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -136,6 +181,14 @@ public:
    */
   void SetCoord(CGeometry *geometry) override;
 
+  /*!
+   * \brief Copy the volume and coordinates of the owner CVs to the halo CVs. With the quality-aware
+   *        agglomeration a halo CV only has the children of its owner that are in the fine halo layer.
+   * \note Requires the point-to-point communication structures.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetHaloControlVolume(const CConfig *config) override;
+
   /*!
    * \brief Set a representative wall normal heat flux of the agglomerated control volume on a particular boundary marker.
    * \param[in] geometry - Geometrical definition of the problem.
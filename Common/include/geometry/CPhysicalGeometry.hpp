@@ -109,6 +109,12 @@ class CPhysicalGeometry final : public CGeometry {
   vector<int> GlobalMarkerStorageDispl;
   vector<su2double> GlobalRoughness_Height;
 
+  su2passivematrix WallDistRefCoord;     /*!< \brief Coordinates of the points at the last full wall distance computation. */
+  vector<passivedouble> WallDistRefValue; /*!< \brief Wall distance of the points at the last full computation. */
+  vector<unsigned short> WallDistZone;   /*!< \brief Zone of the ADT that contains the nearest wall element of each point. */
+  vector<unsigned long> WallDistElem;    /*!< \brief Index in that ADT of the nearest wall element of each point. */
+  unsigned long nWallDistQueries = 0;    /*!< \brief Number of points searched again in an incremental update. */
+
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetVertex;
@@ -791,9 +797,28 @@ public:
 
   /*!
    * \brief Set the wall distance based on an previously constructed ADT
+   * \param[in] config - Definition of the particular problem.
    * \param[in] WallADT - The ADT to compute the wall distance
+   * \param[in] iZoneADT - Zone of the walls stored in the ADT.
+   * \param[in] maxWallDisp - Maximum wall displacement since the last full computation, negative for a full computation.
+   */
+  void SetWallDistance(const CConfig *config, CADTElemClass* WallADT,
+                       unsigned short iZoneADT, su2double maxWallDisp) override;
+
+  /*!
+   * \brief Compute the maximum displacement of the viscous walls since the last full wall distance computation.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] maxWallDisp - Local maximum displacement.
+   * \return False if there is no reference for an incremental update.
+   */
+  bool GetMaxWallDisplacement(const CConfig *config, su2double &maxWallDisp) const override;
+
+  /*!
+   * \brief Store (or invalidate) the reference for the incremental update of the wall distance.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] maxWallDisp - Value used in the last update, negative for a full computation.
    */
-  void SetWallDistance(const CConfig *config, CADTElemClass* WallADT) override;
+  void UpdateWallDistanceReference(const CConfig *config, su2double maxWallDisp) override;
 
   /*!
    * \brief Set wall distances a specific value
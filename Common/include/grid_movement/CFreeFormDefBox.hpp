@@ -75,6 +75,11 @@ public:
 
   CFreeFormBlending** BlendingFunction;
 
+  unsigned short BasisSize[3] = {0,0,0};   /*!< \brief Number of blending functions in each direction. */
+  unsigned short BasisDegree[3] = {0,0,0}; /*!< \brief Degree of the polynomial pieces of the blending functions. */
+  unsigned short BasisSpans[3] = {0,0,0};  /*!< \brief Number of (uniform) polynomial pieces in [0,1]. */
+  vector<su2double> BasisCoeff[3];         /*!< \brief Power basis coefficients of the blending functions, [span][function][power]. */
+
 
 public:
 
@@ -547,6 +552,35 @@ public:
    */
   su2double *GetParametricCoord_Iterative(unsigned long iPoint, su2double *xyz, const su2double *guess, CConfig *config);
 
+  /*!
+   * \brief Convert the blending functions (for the current orders) to piecewise polynomials in power form.
+   * \note The tables can be evaluated concurrently, unlike the blending function objects.
+   */
+  void SetBlendingPolynomials();
+
+  /*!
+   * \brief Evaluate the cartesian coordinates and their derivatives w.r.t. the parametric coordinates
+   *        with the tables of SetBlendingPolynomials (thread-safe).
+   * \param[in] uvw - Parametric coordinates.
+   * \param[out] xyz - Cartesian coordinates.
+   * \param[out] jac - Jacobian, jac[iDim][jDir] = d xyz[iDim] / d uvw[jDir].
+   * \param[in] work - Work array of size 2*(lOrder+mOrder+nOrder).
+   */
+  void EvalCartesianCoord_Poly(const su2double *uvw, su2double *xyz, su2double jac[][3], su2double *work) const;
+
+  /*!
+   * \brief Batched and threaded point inversion, Newton iterations on the polynomial form of the
+   *        blending functions, started from a guess or from the closest point of a coarse lattice.
+   * \param[in] xyz - Cartesian coordinates of the points (nPoint x 3).
+   * \param[in,out] uvw - Parametric coordinates, on input the guesses (used if useGuess).
+   * \param[out] converged - Whether the inversion of each point converged (char, not bool, to be written by threads).
+   * \param[in] useGuess - Start from the input uvw (e.g. previous values), if closer than the lattice.
+   * \param[in] config - Definition of the particular problem.
+   * \return Number of points that did not converge (to be inverted with GetParametricCoord_Iterative).
+   */
+  unsigned long GetParametricCoord_Batch(const su2activematrix& xyz, su2activematrix& uvw, vector<char>& converged,
+                                         bool useGuess, const CConfig *config);
+
   /*!
    * \brief Compute the cross product.
    * \param[in] v1 - First input vector.
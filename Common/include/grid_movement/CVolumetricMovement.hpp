@@ -31,6 +31,7 @@
 #include "../linear_algebra/CSysMatrix.hpp"
 #include "../linear_algebra/CSysVector.hpp"
 #include "../linear_algebra/CSysSolve.hpp"
+#include "../toolboxes/graph_toolbox.hpp"
 
 /*!
  * \class CVolumetricMovement
@@ -39,6 +40,8 @@
  */
 class CVolumetricMovement : public CGridMovement {
 protected:
+  enum : size_t {OMP_MIN_SIZE = 32};
+  enum : size_t {OMP_MAX_SIZE = 512};
 
   unsigned short nDim;    /*!< \brief Number of dimensions. */
   unsigned short nVar;    /*!< \brief Number of variables. */
@@ -58,6 +61,25 @@ protected:
   CSysVector<su2double> LinSysSol;
   CSysVector<su2double> LinSysRes;
 
+  bool PrecondReady = false;  /*!< \brief The preconditioner of the previous solution may be reused. */
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > ElemColoring;   /*!< \brief Element colors. */
+  bool LockStrategy = false;           /*!< \brief Whether to use an OpenMP lock to guard updates of the stiffness matrix. */
+  vector<omp_lock_t> UpdateLocks;      /*!< \brief Locks that may be used to protect accesses to CSysMatrix in element loops. */
+#else
+  array<DummyGridColor<>,1> ElemColoring;      /*--- Behaves like a normal integer type. ---*/
+  static constexpr bool LockStrategy = false;  /*--- Lock strategy is never needed for MPI-only. ---*/
+  DummyVectorOfLocks UpdateLocks;
+#endif
+  unsigned long omp_chunk_size = OMP_MAX_SIZE; /*!< \brief Chunk size used in light point loops. */
+
+  /*!
+   * \brief Set up the element coloring used to assemble the stiffness matrix with OpenMP.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void HybridParallelInitialization(CGeometry* geometry);
+
 public:
 
   /*!
@@ -261,6 +283,26 @@ public:
    */
   void SetDomainDisplacements(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Determine the coordinate axis normal to a symmetry plane.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iMarker - Symmetry plane marker.
+   * \return Index of the axis along which the vertices of the marker are least spread.
+   */
+  unsigned short GetSymmetryAxis(CGeometry *geometry, unsigned short iMarker) const;
+
+  /*!
+   * \brief Grid deformation by inverse distance weighting of the displacements of the nearest boundary points.
+   * \note The displacements are not obtained from a linear solve, the boundary points of all ranks are gathered
+   *       in an ADT and each point interpolates from its DEFORM_IDW_NEIGHBORS nearest ones. The weights are
+   *       tapered to zero at the farthest of those neighbors, so that the field is continuous.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] UpdateGeo - Update geometry.
+   * \param[in] Derivative - Compute the derivative, the transposed operator is applied in SU2_DOT.
+   */
+  void SetVolume_Deformation_IDW(CGeometry *geometry, CConfig *config, bool UpdateGeo, bool Derivative);
+
   /*!
    * \brief Unsteady grid movement using rigid mesh rotation.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -38,6 +38,7 @@ class CRadialBasisFunction final : public CInterpolator {
 private:
   unsigned long MinDonors = 0, AvgDonors = 0, MaxDonors = 0;
   passivedouble Density = 0.0, AvgCorrection = 0.0, MaxCorrection = 0.0;
+  unsigned long NumCenters = 0, NumDonorPoints = 0;
 
 public:
   /*!
@@ -87,6 +88,23 @@ public:
                                      const su2activematrix& coords, int& nPolynomial,
                                      vector<int>& keepPolynomialRow, su2passivematrix& C_inv_trunc);
 
+  /*!
+   * \brief Select a reduced set of RBF centers from the donor points with the P-greedy algorithm, i.e. the
+   * point where the power function is maximum is added until it drops below the tolerance everywhere.
+   * \note The power function is updated with the Newton basis, the cost is O(N * nCenters^2) instead of the
+   * O(N^3) of the full interpolation matrix. Only valid for positive definite kernels.
+   * The donor points are split over the ranks, all of them must call this function with the same coordinates.
+   * \param[in] type - Type of radial basis function.
+   * \param[in] radius - Normalizes point-to-point distance when computing RBF values.
+   * \param[in] coords - Coordinates of the donor points.
+   * \param[in] tolerance - Tolerance on the power function, relative to the value of the RBF at 0.
+   * \param[in] maxCenters - Maximum number of centers, 0 means no limit.
+   * \return Indices of the selected centers, in increasing order.
+   */
+  static vector<unsigned long> SelectCentersGreedy(ENUM_RADIALBASIS type, su2double radius,
+                                                   const su2activematrix& coords, passivedouble tolerance,
+                                                   unsigned long maxCenters);
+
   /*!
    * \brief If the polynomial term is included in the interpolation, and the points lie on a plane, the matrix
    * becomes rank deficient and cannot be inverted. This method detects that condition and corrects it by
@@ -264,6 +264,7 @@ public:
    */
   inline void Build() override {
     sparse_matrix.BuildJacobiPreconditioner(false);
+    sparse_matrix.BuildLineletFactorization();
   }
 };
 
@@ -117,6 +117,12 @@ private:
   const unsigned long *dia_ptr_ilu; /*!< \brief Pointers to the diagonal element in each row (ILU). */
   const unsigned long *col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;       /*!< \brief Fill in level for the ILU preconditioner. */
+  bool ilu_in_place;                /*!< \brief The ILU(0) factorization overwrites the matrix (ILU_matrix == matrix). */
+
+  vector<unsigned long> ilu_lower_level_ptr; /*!< \brief Start of each level of independent rows in ilu_lower_rows. */
+  vector<unsigned long> ilu_lower_rows;      /*!< \brief Rows sorted by level for the factorization and forward sweep. */
+  vector<unsigned long> ilu_upper_level_ptr; /*!< \brief Start of each level of independent rows in ilu_upper_rows. */
+  vector<unsigned long> ilu_upper_rows;      /*!< \brief Rows sorted by level for the backward sweep. */
 
   ScalarType *invM;                 /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
@@ -124,10 +130,18 @@ private:
   vector<bool> LineletBool;                    /*!< \brief Identify if a point belong to a Linelet. */
   vector<vector<unsigned long> > LineletPoint; /*!< \brief Linelet structure. */
 
+  /*--- Factorization of the block-tridiagonal systems of the linelets. The linelets are sorted by length and
+   *    grouped in batches, the entries of the linelets of a batch are interleaved (the index of the linelet
+   *    in the batch is the fastest) such that the substitutions are vectorized across linelets. ---*/
+  enum : unsigned long {LINELET_BATCH = 8};   /*!< \brief Number of linelets per batch. */
+  vector<unsigned long> LineletOrder;         /*!< \brief Linelets of each batch (nLinelet for the padding of the last batch). */
+  vector<unsigned long> LineletBatchPtr;      /*!< \brief Start of the blocks of each batch, the length of its longest linelet. */
+  vector<ScalarType> LineletInvDiag;          /*!< \brief Inverse of the modified diagonal blocks. */
+  vector<ScalarType> LineletLower;            /*!< \brief Elimination weights (lower blocks times inverse of the previous modified diagonal). */
+  vector<ScalarType> LineletUpper;            /*!< \brief Upper blocks. */
+
   /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
-  mutable vector<vector<const ScalarType*> > LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag system (working memory). */
-  mutable vector<vector<ScalarType> > LineletInvDiag;      /*!< \brief Inverse of the diagonal blocks of the tri-diag system (working memory). */
-  mutable vector<vector<ScalarType> > LineletVector;       /*!< \brief Solution and RHS of the tri-diag system (working memory). */
+  mutable vector<vector<ScalarType> > LineletVector; /*!< \brief Solution and RHS of the tri-diag systems of a batch (working memory). */
 
 #ifdef USE_MKL
   using gemm_t = typename mkl_jit_wrapper<ScalarType>::gemm_t;
@@ -304,6 +318,39 @@ private:
    */
   inline void SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType *val_block);
 
+  /*!
+   * \brief Incomplete factorization of a row of the ILU matrix, it stores the inverse of the diagonal block.
+   * \note The rows it depends on (within the bounds) must have been factorized.
+   * \param[in] row_i - Row of the ILU matrix.
+   * \param[in] col_lb - Inclusive lower bound for the columns considered.
+   * \param[in] col_ub - Exclusive upper bound for the columns considered.
+   */
+  inline void FactorizeRow_ILUMatrix(unsigned long row_i, unsigned long col_lb, unsigned long col_ub);
+
+  /*!
+   * \brief Forward substitution of a row of the ILU factorization, prod_i = vec_i - L_ij prod_j.
+   * \param[in] vec - Right hand side.
+   * \param[in,out] prod - Solution, the entries of the previous rows must be available.
+   * \param[in] row_i - Row of the ILU matrix.
+   * \param[in] col_lb - Inclusive lower bound for the columns considered.
+   */
+  inline void ForwardRow_ILUMatrix(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                   unsigned long row_i, unsigned long col_lb) const;
+
+  /*!
+   * \brief Backward substitution of a row of the ILU factorization, prod_i = inv(D_i) (prod_i - U_ij prod_j).
+   * \param[in,out] prod - Solution, the entries of the next rows must be available.
+   * \param[in] row_i - Row of the ILU matrix.
+   * \param[in] col_ub - Exclusive upper bound for the columns considered.
+   */
+  inline void BackwardRow_ILUMatrix(CSysVector<ScalarType> & prod, unsigned long row_i, unsigned long col_ub) const;
+
+  /*!
+   * \brief Group the rows of the ILU pattern in levels of independent rows, for the thread-parallel
+   *        factorization and sweeps (level scheduling). Rows of a level only depend on rows of lower levels.
+   */
+  void BuildILULevels();
+
   /*!
    * \brief Performs the product of i-th row of the upper part of a sparse matrix by a vector.
    * \param[in] vec - Vector to be multiplied by the upper part of the sparse matrix A.
@@ -368,6 +415,19 @@ public:
                   bool EdgeConnect, CGeometry *geometry,
                   const CConfig *config, bool needTranspPtr = false);
 
+  /*!
+   * \brief Whether the ILU(0) factorization overwrites the entries of the matrix.
+   * \note When it does, products with the matrix are meaningless after the preconditioner is built.
+   */
+  inline bool GetILUInPlace() const { return ilu_in_place; }
+
+  /*!
+   * \brief Memory used by the entries of the matrix and of its preconditioners, the sparse
+   *        pattern is managed by CGeometry (shared by all the matrices) and is not included.
+   * \return Number of bytes allocated in this rank.
+   */
+  unsigned long GetMemoryFootprint() const;
+
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
    */
@@ -869,6 +929,13 @@ public:
    */
   unsigned long BuildLineletPreconditioner(CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Factorize the block-tridiagonal systems of the linelets (Thomas algorithm), such that
+   *        applying the preconditioner (e.g. as a line-implicit smoother) only needs the substitutions.
+   * \note The structure must have been built by BuildLineletPreconditioner.
+   */
+  void BuildLineletFactorization();
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
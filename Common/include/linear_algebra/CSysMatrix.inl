@@ -186,6 +186,91 @@ FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned
   MatrixInverse(block, invBlock);
 }
 
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::FactorizeRow_ILUMatrix(unsigned long row_i, unsigned long col_lb,
+                                                                unsigned long col_ub) {
+  ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
+
+  /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+
+  for (auto index = row_ptr_ilu[row_i]; index < dia_ptr_ilu[row_i]; index++) {
+
+    /*--- col_j is the column index (col_j < row_i). ---*/
+
+    auto col_j = col_ind_ilu[index];
+
+    if (col_j < col_lb) continue;
+
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    MatrixMatrixProduct(Block_ij, &invM[col_j*nVar*nVar], weight);
+
+    /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the col_j row. ---*/
+
+    for (auto index_ = dia_ptr_ilu[col_j]+1; index_ < row_ptr_ilu[col_j+1]; index_++) {
+
+      /*--- Get the column index (col_k > col_j). ---*/
+
+      auto col_k = col_ind_ilu[index_];
+
+      if (col_k >= col_ub) break;
+
+      /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+
+      auto Block_ik = GetBlock_ILUMatrix(row_i, col_k);
+
+      if (Block_ik != nullptr) {
+        auto Block_jk = &ILU_matrix[index_*nVar*nVar];
+        MatrixMatrixProduct(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
+      }
+    }
+
+    /*--- Lastly, store "weight" in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
+
+    for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
+      Block_ij[iVar] = weight[iVar];
+  }
+
+  /*--- The diagonal block is final, invert and store it. ---*/
+
+  InverseDiagonalBlock_ILUMatrix(row_i, &invM[row_i*nVar*nVar]);
+}
+
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::ForwardRow_ILUMatrix(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                              unsigned long row_i, unsigned long col_lb) const {
+  for (auto iVar = 0ul; iVar < nVar; iVar++)
+    prod(row_i,iVar) = vec(row_i,iVar);
+
+  for (auto index = row_ptr_ilu[row_i]; index < dia_ptr_ilu[row_i]; index++) {
+    auto col_j = col_ind_ilu[index];
+    if (col_j < col_lb) continue;
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    MatrixVectorProductSub(Block_ij, &prod[col_j*nVar], &prod[row_i*nVar]);
+  }
+}
+
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::BackwardRow_ILUMatrix(CSysVector<ScalarType> & prod, unsigned long row_i,
+                                                               unsigned long col_ub) const {
+  ScalarType aux_vec[MAXNVAR];
+
+  for (auto iVar = 0ul; iVar < nVar; iVar++)
+    aux_vec[iVar] = prod(row_i,iVar);
+
+  for (auto index = dia_ptr_ilu[row_i]+1; index < row_ptr_ilu[row_i+1]; index++) {
+    auto col_j = col_ind_ilu[index];
+    if (col_j >= col_ub) break;
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    MatrixVectorProductSub(Block_ij, &prod[col_j*nVar], aux_vec);
+  }
+
+  MatrixVectorProduct(&invM[row_i*nVar*nVar], aux_vec, &prod[row_i*nVar]);
+}
+
 template<class ScalarType>
 FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType> & vec,
                                                     unsigned long row_i, ScalarType *prod) const {
@@ -94,6 +94,18 @@ private:
 
   mutable std::vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
+  mutable std::vector<VectorType> AZ; /*!< \brief Used by pipelined GMRES, AZ^i = A * z^i. */
+  mutable std::vector<VectorType> pipe_vec; /*!< \brief Work vectors of the pipelined CG and BCGSTAB. */
+
+  mutable std::vector<ScalarType> dots_local;  /*!< \brief Partial (this rank) results of fused dot products. */
+  mutable std::vector<ScalarType> dots_global; /*!< \brief Reduced results of fused dot products. */
+  mutable std::vector<ScalarType> dots_thread; /*!< \brief Per thread partial results of fused dot products. */
+  mutable CBaseMPIWrapper::Request dots_request; /*!< \brief Handle of the non-blocking reduction of the dot products. */
+  mutable bool dots_pending = false;             /*!< \brief If the reduction of the dot products needs to be completed. */
+
+  mutable std::vector<VectorType> RecU; /*!< \brief Recycled directions of RECYCLING_GCRO (solution space). */
+  mutable std::vector<VectorType> RecC; /*!< \brief Orthonormal products of the recycled directions with the matrix, C = A * U. */
+  mutable std::vector<unsigned long> rec_order; /*!< \brief Slots of RecU/C in use, from oldest to newest. */
 
   VectorType  LinSysSol_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysRes_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
@@ -101,6 +113,7 @@ private:
   const VectorType* LinSysRes_ptr;  /*!< \brief Pointer to appropriate LinSysRes (set to original or temporary in call to Solve). */
 
   LinearToleranceType tol_type = LinearToleranceType::RELATIVE; /*!< \brief How the linear solvers interpret the tolerance. */
+  bool reuse_precond = false;       /*!< \brief Skip the build of the preconditioner in Solve (reuse the factorization held by the matrix). */
 
   /*!
    * \brief sign transfer function
@@ -170,6 +183,29 @@ private:
    */
   void ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType> & w) const;
 
+  /*!
+   * \brief Start the computation of several dot products, (a[k], b[k]), fused in a single pass
+   *        over the vectors and a single global reduction, which is non-blocking for passive types.
+   * \note All threads must call this, and then FinishDotProducts before using the results.
+   *       Work that does not depend on the results can be done in between to hide the latency.
+   * \param[in] a - First vector of each product.
+   * \param[in] b - Second vector of each product.
+   */
+  void StartDotProducts(const std::vector<const VectorType*>& a, const std::vector<const VectorType*>& b) const;
+
+  /*!
+   * \brief Complete the reduction started by StartDotProducts.
+   * \return Pointer to the results, valid until the next call to StartDotProducts.
+   */
+  const ScalarType* FinishDotProducts() const;
+
+  /*!
+   * \brief Allocate (if needed) the work vectors of the pipelined CG and BCGSTAB.
+   * \param[in] n - Number of vectors.
+   * \param[in] x - Vector with the required size.
+   */
+  void AllocatePipelined(unsigned long n, const VectorType& x) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -333,6 +369,83 @@ public:
                                   const PrecondType & precond, ScalarType tol, unsigned long m,
                                   ScalarType & residual, bool monitoring, const CConfig *config) const;
 
+  /*!
+   * \brief Pipelined preconditioned Conjugate Gradient method (Ghysels and Vanroose).
+   * \note The 3 dot products of each iteration are fused in one reduction, which is overlapped with
+   *       the preconditioner and the matrix-vector product. The residual used for convergence checks
+   *       lags one iteration. The preconditioner must be symmetric and fixed.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PipelinedCG_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                      const PrecondType & precond, ScalarType tol, unsigned long m,
+                                      ScalarType & residual, bool monitoring, const CConfig *config) const;
+
+  /*!
+   * \brief Pipelined (right preconditioned) GMRES, p(1)-GMRES of Ghysels et al.
+   * \note Classical Gram-Schmidt with two passes, the dot products of each pass are fused in one
+   *       reduction. The first is overlapped with the preconditioner and the matrix-vector product of
+   *       the next iteration, the second (which also gives the norm by Pythagoras' theorem) is blocking.
+   *       Unlike FGMRES the preconditioner must be fixed (linear), and one more set of basis vectors is stored.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PipelinedGMRES_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                         const PrecondType & precond, ScalarType tol, unsigned long m,
+                                         ScalarType & residual, bool monitoring, const CConfig *config) const;
+
+  /*!
+   * \brief Pipelined (right preconditioned) BCGSTAB, p-BiCGStab of Cools and Vanroose.
+   * \note The 2 global reductions of each iteration are non-blocking and overlapped with the
+   *       preconditioner and matrix-vector products. The preconditioner must be fixed (linear).
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PipelinedBCGSTAB_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                           const PrecondType & precond, ScalarType tol, unsigned long m,
+                                           ScalarType & residual, bool monitoring, const CConfig *config) const;
+
+  /*!
+   * \brief Restarted flexible GCRO with recycling of directions across calls (GCROT-like truncation).
+   * \note The correction of each cycle (restart frequency iterations) is added to the recycled subspace
+   *       (the oldest direction is dropped when full). In the next solves the subspace is first
+   *       orthonormalized w.r.t. the current matrix, used to improve the initial guess, and kept out
+   *       of the Krylov subspaces, which is effective for slowly varying sequences of systems.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long RecyclingGCRO_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                       const PrecondType & precond, ScalarType tol, unsigned long m,
+                                       ScalarType & residual, bool monitoring, const CConfig *config) const;
+
   /*!
    * \brief Generic smoother (modified Richardson iteration with preconditioner)
    * \param[in] b - the right hand size vector
@@ -388,4 +501,11 @@ public:
    */
   inline void SetToleranceType(LinearToleranceType type) {tol_type = type;}
 
+  /*!
+   * \brief Reuse the preconditioner built by a previous call to Solve instead of building a new one.
+   * \note Only meaningful for preconditioners whose data is stored by the matrix (ILU, JACOBI),
+   *       the caller is responsible for deciding when the old factorization is still adequate.
+   */
+  inline void SetReusePreconditioner(bool reuse) {reuse_precond = reuse;}
+
 };
@@ -158,6 +158,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -402,6 +405,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
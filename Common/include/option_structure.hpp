@@ -1010,7 +1010,8 @@ enum ENUM_TIME_INT {
   EULER_EXPLICIT = 2,         /*!< \brief Explicit Euler time integration definition. */
   EULER_IMPLICIT = 3,         /*!< \brief Implicit Euler time integration definition. */
   CLASSICAL_RK4_EXPLICIT = 4, /*!< \brief Classical RK4 time integration definition. */
-  ADER_DG = 5                 /*!< \brief ADER-DG time integration definition. */
+  ADER_DG = 5,                /*!< \brief ADER-DG time integration definition. */
+  LOW_STORAGE_RK_EXPLICIT = 6 /*!< \brief Low-storage (two register) Runge-Kutta time integration definition. */
 };
 static const MapType<string, ENUM_TIME_INT> Time_Int_Map = {
   MakePair("RUNGE-KUTTA_EXPLICIT", RUNGE_KUTTA_EXPLICIT)
@@ -1018,6 +1019,23 @@ static const MapType<string, ENUM_TIME_INT> Time_Int_Map = {
   MakePair("EULER_IMPLICIT", EULER_IMPLICIT)
   MakePair("CLASSICAL_RK4_EXPLICIT", CLASSICAL_RK4_EXPLICIT)
   MakePair("ADER_DG", ADER_DG)
+  MakePair("LOW_STORAGE_RK_EXPLICIT", LOW_STORAGE_RK_EXPLICIT)
+};
+
+/*!
+ * \brief Low-storage Runge-Kutta schemes, all written as U = a*U^n + (1-a)*U + B*S, with S = A*S - dt*R(U).
+ */
+enum ENUM_LOW_STORAGE_RK {
+  LSRK3_WILLIAMSON = 0,         /*!< \brief 3 stage, 3rd order, 2N scheme of Williamson. */
+  LSRK4_CARPENTER_KENNEDY = 1,  /*!< \brief 5 stage, 4th order, 2N scheme of Carpenter and Kennedy. */
+  SSP_RK2 = 2,                  /*!< \brief 2 stage, 2nd order, strong stability preserving scheme (Heun). */
+  SSP_RK3 = 3                   /*!< \brief 3 stage, 3rd order, strong stability preserving scheme of Shu and Osher. */
+};
+static const MapType<string, ENUM_LOW_STORAGE_RK> LowStorageRK_Map = {
+  MakePair("LSRK3_WILLIAMSON", LSRK3_WILLIAMSON)
+  MakePair("LSRK4_CARPENTER_KENNEDY", LSRK4_CARPENTER_KENNEDY)
+  MakePair("SSP_RK2", SSP_RK2)
+  MakePair("SSP_RK3", SSP_RK3)
 };
 
 /*!
@@ -1890,6 +1908,10 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER = 8,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT = 9,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU = 10,           /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_CG = 11,        /*!< \brief Pipelined (single reduction, overlapped) preconditioned conjugate gradient. */
+  PIPELINED_GMRES = 12,     /*!< \brief Pipelined (single reduction, overlapped) GMRES with fixed preconditioner. */
+  PIPELINED_BCGSTAB = 13,   /*!< \brief Pipelined (overlapped reductions) BCGSTAB with fixed preconditioner. */
+  RECYCLING_GCRO = 14,      /*!< \brief Restarted GCRO recycling directions across consecutive solves. */
 };
 static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1902,6 +1924,10 @@ static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
+  MakePair("PIPELINED_CG", PIPELINED_CG)
+  MakePair("PIPELINED_GMRES", PIPELINED_GMRES)
+  MakePair("PIPELINED_BCGSTAB", PIPELINED_BCGSTAB)
+  MakePair("RECYCLING_GCRO", RECYCLING_GCRO)
 };
 
 /*!
@@ -2052,6 +2078,18 @@ static const MapType<string, ENUM_DEFORM_STIFFNESS> Deform_Stiffness_Map = {
   MakePair("WALL_DISTANCE", SOLID_WALL_DISTANCE)
 };
 
+/*!
+ * \brief Methods to propagate the surface displacements to the volume mesh.
+ */
+enum ENUM_DEFORM_METHOD {
+  ELASTICITY_DEFORM = 0,   /*!< \brief Solve the linear elasticity equations (FEA). */
+  IDW_DEFORM = 1           /*!< \brief Inverse distance weighting of the nearest boundary displacements (no linear solve). */
+};
+static const MapType<string, ENUM_DEFORM_METHOD> Deform_Method_Map = {
+  MakePair("LINEAR_ELASTICITY", ELASTICITY_DEFORM)
+  MakePair("INVERSE_DISTANCE", IDW_DEFORM)
+};
+
 /*!
  * \brief The direct differentation variables.
  */
@@ -2181,7 +2219,8 @@ enum MPI_QUANTITIES {
   MESH_DISPLACEMENTS   = 27,  /*!< \brief Mesh displacements at the interface. */
   SOLUTION_TIME_N      = 28,  /*!< \brief Solution at time n. */
   SOLUTION_TIME_N1     = 29,   /*!< \brief Solution at time n-1. */
-  PRIMITIVE            = 30   /*!< \brief Primitive solution communication. */
+  PRIMITIVE            = 30,  /*!< \brief Primitive solution communication. */
+  CONTROL_VOLUME       = 31   /*!< \brief Control volume communication. */
 };
 
 /*!
@@ -1635,6 +1635,12 @@ void CConfig::SetConfig_Options() {
   // these options share nRKStep as their size, which is not a good idea in general
   /* DESCRIPTION: Runge-Kutta alpha coefficients */
   addDoubleListOption("RK_ALPHA_COEFF", nRKStep, RK_Alpha_Step);
+  /* DESCRIPTION: Scheme of the low-storage Runge-Kutta time integration (TIME_DISCRE_FLOW= LOW_STORAGE_RK_EXPLICIT) */
+  addEnumOption("LOW_STORAGE_RK_SCHEME", Kind_LowStorageRK, LowStorageRK_Map, LSRK4_CARPENTER_KENNEDY);
+  /* DESCRIPTION: Coefficient of the implicit residual smoothing of the explicit schemes (0 disables it) */
+  addDoubleOption("RES_SMOOTHING_COEFF", ResSmoothing_Coeff, 0.0);
+  /* DESCRIPTION: Number of Jacobi sweeps of the implicit residual smoothing */
+  addUnsignedShortOption("RES_SMOOTHING_ITER", ResSmoothing_Iter, 2);
   /* DESCRIPTION: Number of time levels for time accurate local time stepping. */
   addUnsignedShortOption("LEVELS_TIME_ACCURATE_LTS", nLevels_TimeAccurateLTS, 1);
   /* DESCRIPTION: Number of time DOFs used in the predictor step of ADER-DG. */
@@ -1691,12 +1697,32 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Thread-parallel ILU via level scheduling, instead of independent partitions per thread */
+  addBoolOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING", Linear_Solver_ILU_Levels, false);
+  /* DESCRIPTION: Factorize the matrix in place (ILU(0) with a single smoothing iteration), halves the memory of matrix plus ILU */
+  addBoolOption("LINEAR_SOLVER_ILU_IN_PLACE", Linear_Solver_ILU_InPlace, false);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Max number of directions recycled from previous linear solves (RECYCLING_GCRO) */
+  addUnsignedShortOption("LINEAR_SOLVER_RECYCLE_SIZE", Linear_Solver_Recycle_Size, 10);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Jacobian-free Newton-Krylov iterations for steady compressible flows (preconditioned by the linear solver above) */
+  addBoolOption("NEWTON_KRYLOV", NewtonKrylov, false);
+  /* DESCRIPTION: CFL number (smallest local value if adaptive) above which the Newton iterations replace the pseudo-time steps */
+  addDoubleOption("NEWTON_KRYLOV_CFL", NewtonKrylov_CFL, 100.0);
+  /* DESCRIPTION: Maximum number of Krylov iterations per Newton step */
+  addUnsignedLongOption("NEWTON_KRYLOV_ITER", NewtonKrylov_Iter, 20);
+  /* DESCRIPTION: Relative tolerance of the Newton steps (inexact Newton) */
+  addDoubleOption("NEWTON_KRYLOV_TOL", NewtonKrylov_Tol, 0.1);
+  /* DESCRIPTION: Scale of the finite difference step used for the Jacobian-vector products */
+  addDoubleOption("NEWTON_KRYLOV_EPS", NewtonKrylov_Eps, 1E-7);
+  /* DESCRIPTION: Max number of implicit iterations between assemblies of the flow Jacobian (1 to assemble every iteration) */
+  addUnsignedLongOption("JACOBIAN_REUSE_FREQUENCY", Jacobian_Reuse_Freq, 1);
+  /* DESCRIPTION: The Jacobian is assembled earlier if the linear iterations grow by this factor w.r.t. the last fresh Jacobian */
+  addDoubleOption("JACOBIAN_REUSE_FACTOR", Jacobian_Reuse_Factor, 2.0);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1764,6 +1790,12 @@ void CConfig::SetConfig_Options() {
   addUnsignedShortOption("MGLEVEL", nMGLevels, 0);
   /*!\brief MGCYCLE\n DESCRIPTION: Multi-grid cycle. OPTIONS: See \link MG_Cycle_Map \endlink. Defualt V_CYCLE \ingroup Config*/
   addEnumOption("MGCYCLE", MGCycle, MG_Cycle_Map, V_CYCLE);
+  /*!\brief MULTIGRID_TURB\n DESCRIPTION: Solve the turbulence model with the multigrid (instead of the fine grid only). DEFAULT: NO \ingroup Config*/
+  addBoolOption("MULTIGRID_TURB", Multigrid_Turb, false);
+  /*!\brief MG_QUALITY_AGGLOMERATION\n DESCRIPTION: Agglomerate partition interfaces as interior points, and directionally in stretched regions. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_QUALITY_AGGLOMERATION", MG_QualityAgglomeration, false);
+  /*!\brief MG_DIRECTIONAL_RATIO\n DESCRIPTION: Anisotropy of the coupling of a point above which the agglomeration is directional. DEFAULT: 10.0 \ingroup Config*/
+  addDoubleOption("MG_DIRECTIONAL_RATIO", MG_DirectionalRatio, 10.0);
   /*!\brief MG_PRE_SMOOTH\n DESCRIPTION: Multi-grid pre-smoothing level \ingroup Config*/
   addUShortListOption("MG_PRE_SMOOTH", nMG_PreSmooth, MG_PreSmooth);
   /*!\brief MG_POST_SMOOTH\n DESCRIPTION: Multi-grid post-smoothing level \ingroup Config*/
@@ -2242,8 +2274,16 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DEFORM_COEFF", Deform_Coeff, 1E6);
   /* DESCRIPTION: Deform limit in m or inches */
   addDoubleOption("DEFORM_LIMIT", Deform_Limit, 1E6);
+  /* DESCRIPTION: Relative tolerance for the incremental update of the wall distance of moving/deforming meshes (0 recomputes it from scratch) */
+  addDoubleOption("WALL_DISTANCE_UPDATE_TOL", WallDistance_UpdateTol, 0.0);
   /* DESCRIPTION: Type of element stiffness imposed for FEA mesh deformation (INVERSE_VOLUME, WALL_DISTANCE, CONSTANT_STIFFNESS) */
   addEnumOption("DEFORM_STIFFNESS_TYPE", Deform_StiffnessType, Deform_Stiffness_Map, SOLID_WALL_DISTANCE);
+  /* DESCRIPTION: Method to propagate the surface displacements to the volume (LINEAR_ELASTICITY, INVERSE_DISTANCE) */
+  addEnumOption("DEFORM_METHOD", Deform_Method, Deform_Method_Map, ELASTICITY_DEFORM);
+  /* DESCRIPTION: Number of nearest boundary points used by the inverse distance weighting deformation */
+  addUnsignedLongOption("DEFORM_IDW_NEIGHBORS", Deform_IDW_Neighbors, 32);
+  /* DESCRIPTION: Exponent of the inverse distance weights */
+  addDoubleOption("DEFORM_IDW_EXPONENT", Deform_IDW_Exponent, 3.0);
   /* DESCRIPTION: Poisson's ratio for constant stiffness FEA method of grid deformation */
   addDoubleOption("DEFORM_ELASTICITY_MODULUS", Deform_ElasticityMod, 2E11);
   /* DESCRIPTION: Young's modulus and Poisson's ratio for constant stiffness FEA method of grid deformation */
@@ -2258,6 +2298,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DEFORM_LINEAR_SOLVER_ERROR", Deform_Linear_Solver_Error, 1E-14);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("DEFORM_LINEAR_SOLVER_ITER", Deform_Linear_Solver_Iter, 1000);
+  /* DESCRIPTION: Reuse the preconditioner of the mesh deformation while the linear solver needs at most this number of iterations (0 = always rebuild) */
+  addUnsignedLongOption("DEFORM_LINEAR_SOLVER_PREC_REUSE", Deform_Linear_Solver_Prec_Reuse, 0);
 
   /*!\par CONFIG_CATEGORY: Rotorcraft problem \ingroup Config*/
   /*--- option related to rotorcraft problems ---*/
@@ -2484,6 +2526,14 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Tolerance to prune small coefficients from the RBF interpolation matrix. */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, 1e-6);
 
+  /* DESCRIPTION: Tolerance on the power function for the greedy selection of a reduced set of RBF centers,
+   * only for positive definite kernels. 0 uses all donor points as centers. */
+  addDoubleOption("RADIAL_BASIS_FUNCTION_GREEDY_TOLERANCE", RadialBasisFunction_GreedyTol, 0.0);
+
+  /* DESCRIPTION: Maximum number of RBF centers selected by the greedy algorithm, 0 means no limit.
+   * Requires a positive RADIAL_BASIS_FUNCTION_GREEDY_TOLERANCE. */
+  addUnsignedLongOption("RADIAL_BASIS_FUNCTION_MAX_CENTERS", RadialBasisFunction_MaxCenters, 0);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -3477,6 +3527,48 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     Kind_Regime = NO_FLOW;
   }
 
+  /*--- The Newton-Krylov iterations are implemented for the single grid,
+   *    steady, implicit, compressible (ideal gas, perfect gas) flow solvers. ---*/
+
+  if (NewtonKrylov) {
+    if ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS))
+      SU2_MPI::Error("NEWTON_KRYLOV is only available for the compressible EULER, NAVIER_STOKES, and RANS solvers.", CURRENT_FUNCTION);
+    if ((TimeMarching != STEADY) || (Kind_TimeIntScheme_Flow != EULER_IMPLICIT))
+      SU2_MPI::Error("NEWTON_KRYLOV requires a steady problem with TIME_DISCRE_FLOW= EULER_IMPLICIT.", CURRENT_FUNCTION);
+    if (nMGLevels != 0)
+      SU2_MPI::Error("NEWTON_KRYLOV requires MGLEVEL= 0.", CURRENT_FUNCTION);
+    if (Low_Mach_Precon || (Kind_Upwind_Flow == TURKEL))
+      SU2_MPI::Error("NEWTON_KRYLOV is not compatible with low Mach preconditioning (LOW_MACH_PREC, TURKEL_PREC).", CURRENT_FUNCTION);
+    if (ContinuousAdjoint || DiscreteAdjoint)
+      SU2_MPI::Error("NEWTON_KRYLOV is not available for adjoint problems.", CURRENT_FUNCTION);
+  }
+
+  /*--- In-place ILU, the matrix is destroyed by the factorization and therefore the
+   *    linear solver cannot compute products with it, only one ILU(0) sweep is possible. ---*/
+
+  if (Linear_Solver_ILU_InPlace) {
+    if ((Kind_Linear_Solver != SMOOTHER) || (Kind_Linear_Solver_Prec != ILU) ||
+        (Linear_Solver_ILU_n != 0) || (Linear_Solver_Iter != 1))
+      SU2_MPI::Error("LINEAR_SOLVER_ILU_IN_PLACE requires LINEAR_SOLVER= SMOOTHER, LINEAR_SOLVER_PREC= ILU,\n"
+                     "LINEAR_SOLVER_ILU_FILL_IN= 0, and LINEAR_SOLVER_ITER= 1.", CURRENT_FUNCTION);
+    if (NewtonKrylov || ContinuousAdjoint || DiscreteAdjoint)
+      SU2_MPI::Error("LINEAR_SOLVER_ILU_IN_PLACE is not available for NEWTON_KRYLOV or adjoint problems.", CURRENT_FUNCTION);
+  }
+
+  /*--- Lagged Jacobians, the flow Jacobian is the preconditioner of the Newton-Krylov
+   *    iterations and the adjoint solvers need the exact linearization. ---*/
+
+  if (Jacobian_Reuse_Freq == 0) Jacobian_Reuse_Freq = 1;
+
+  if (Jacobian_Reuse_Freq > 1) {
+    if (NewtonKrylov)
+      SU2_MPI::Error("JACOBIAN_REUSE_FREQUENCY > 1 is not compatible with NEWTON_KRYLOV.", CURRENT_FUNCTION);
+    if (ContinuousAdjoint || DiscreteAdjoint)
+      Jacobian_Reuse_Freq = 1;
+    if (Jacobian_Reuse_Factor < 1.0)
+      SU2_MPI::Error("JACOBIAN_REUSE_FACTOR must be at least 1.", CURRENT_FUNCTION);
+  }
+
   if ((rank == MASTER_NODE) && ContinuousAdjoint && (Ref_NonDim == DIMENSIONAL) && (Kind_SU2 == SU2_CFD)) {
     cout << "WARNING: The adjoint solver should use a non-dimensional flow solution." << endl;
   }
@@ -3629,6 +3721,14 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     SU2_MPI::Error("Number of KIND_SURFACE_MOVEMENT must match number of MARKER_MOVING", CURRENT_FUNCTION);
   }
 
+  if (RadialBasisFunction_GreedyTol < 0.0) {
+    SU2_MPI::Error("RADIAL_BASIS_FUNCTION_GREEDY_TOLERANCE must not be negative.", CURRENT_FUNCTION);
+  }
+
+  if ((RadialBasisFunction_MaxCenters > 0) && (RadialBasisFunction_GreedyTol <= 0.0)) {
+    SU2_MPI::Error("RADIAL_BASIS_FUNCTION_MAX_CENTERS requires a positive RADIAL_BASIS_FUNCTION_GREEDY_TOLERANCE.", CURRENT_FUNCTION);
+  }
+
   if (Time_Domain && Time_Step <= 0.0 && Unst_CFL == 0.0){
     SU2_MPI::Error("Invalid value for TIME_STEP.", CURRENT_FUNCTION);
   }
@@ -4036,6 +4136,25 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
       (Kind_Turb_Model != NONE))
     Kind_Solver = INC_RANS;
 
+  /*--- Multigrid of the turbulence model, the coarse levels solve the FAS problem of the
+   *    steady, direct, RANS equations, the full multigrid start up is done by the flow only. ---*/
+
+  if (nMGLevels == 0) Multigrid_Turb = false;
+
+  if (Multigrid_Turb) {
+    if ((Kind_Solver != RANS) && (Kind_Solver != INC_RANS))
+      SU2_MPI::Error("MULTIGRID_TURB is only available for the RANS and INC_RANS solvers.", CURRENT_FUNCTION);
+    if (TimeMarching != STEADY)
+      SU2_MPI::Error("MULTIGRID_TURB requires a steady problem.", CURRENT_FUNCTION);
+    if (MGCycle == FULLMG_CYCLE)
+      SU2_MPI::Error("MULTIGRID_TURB is not compatible with MGCYCLE= FULLMG_CYCLE.", CURRENT_FUNCTION);
+    if (ContinuousAdjoint || DiscreteAdjoint)
+      SU2_MPI::Error("MULTIGRID_TURB is not available for adjoint problems.", CURRENT_FUNCTION);
+  }
+
+  if (MG_QualityAgglomeration && (MG_DirectionalRatio <= 1.0))
+    SU2_MPI::Error("MG_DIRECTIONAL_RATIO must be greater than 1.", CURRENT_FUNCTION);
+
   if (Kind_Solver == EULER ||
       Kind_Solver == INC_EULER ||
       Kind_Solver == NEMO_EULER ||
@@ -4482,6 +4601,47 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
      Kind_TimeIntScheme_Flow = Kind_TimeIntScheme_FEM_Flow;
   }
 
+  /*--- Low-storage Runge-Kutta schemes and implicit residual smoothing, only
+   *    implemented for the explicit compressible (finite volume) flow solvers. ---*/
+
+  const bool compressible_fvm = (Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS);
+
+  if ((Kind_TimeIntScheme_Flow == LOW_STORAGE_RK_EXPLICIT) && !compressible_fvm)
+    SU2_MPI::Error("LOW_STORAGE_RK_EXPLICIT is only available for the compressible EULER, NAVIER_STOKES, and RANS solvers.", CURRENT_FUNCTION);
+
+  if (ResSmoothing_Coeff < 0.0)
+    SU2_MPI::Error("RES_SMOOTHING_COEFF must be non-negative.", CURRENT_FUNCTION);
+
+  if (ResSmoothing_Coeff > 0.0) {
+    if (!compressible_fvm || (Kind_TimeIntScheme_Flow == EULER_IMPLICIT))
+      SU2_MPI::Error("RES_SMOOTHING_COEFF is only available for the explicit schemes of the compressible "
+                     "EULER, NAVIER_STOKES, and RANS solvers.", CURRENT_FUNCTION);
+    if (ResSmoothing_Iter == 0) ResSmoothing_Coeff = 0.0;
+  }
+
+  /*--- Coefficients (A, B, a) of the stages. ---*/
+
+  const su2double lsrk3[][3] = {{0.0, 1.0/3.0, 0.0}, {-5.0/9.0, 15.0/16.0, 0.0}, {-153.0/128.0, 8.0/15.0, 0.0}};
+  const su2double lsrk4[][3] = {
+    {0.0, 1432997174477.0/9575080441755.0, 0.0},
+    {-567301805773.0/1357537059087.0, 5161836677717.0/13612068292357.0, 0.0},
+    {-2404267990393.0/2016746695238.0, 1720146321549.0/2090206949498.0, 0.0},
+    {-3550918686646.0/2091501179385.0, 3134564353537.0/4481467310338.0, 0.0},
+    {-1275806237668.0/842570457699.0, 2277821191437.0/14882151754819.0, 0.0}};
+  const su2double ssprk2[][3] = {{0.0, 1.0, 0.0}, {0.0, 0.5, 0.5}};
+  const su2double ssprk3[][3] = {{0.0, 1.0, 0.0}, {0.0, 0.25, 0.75}, {0.0, 2.0/3.0, 1.0/3.0}};
+
+  const su2double (*lsrk_coeff)[3] = nullptr;
+  switch (Kind_LowStorageRK) {
+    case LSRK3_WILLIAMSON:        nLowStorageRKStep = 3; lsrk_coeff = lsrk3; break;
+    case LSRK4_CARPENTER_KENNEDY: nLowStorageRKStep = 5; lsrk_coeff = lsrk4; break;
+    case SSP_RK2:                 nLowStorageRKStep = 2; lsrk_coeff = ssprk2; break;
+    case SSP_RK3:                 nLowStorageRKStep = 3; lsrk_coeff = ssprk3; break;
+  }
+  for (unsigned short iStep = 0; iStep < nLowStorageRKStep; iStep++)
+    for (unsigned short iCoeff = 0; iCoeff < 3; iCoeff++)
+      LowStorageRK_Coeff[iStep][iCoeff] = lsrk_coeff[iStep][iCoeff];
+
   /*--- Set up the time stepping / unsteady CFL options. ---*/
   if ((TimeMarching == TIME_STEPPING) && (Unst_CFL != 0.0)) {
     for (iCFL = 0; iCFL < nCFL; iCFL++)
@@ -6425,8 +6585,17 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case PIPELINED_GMRES:
+            case PIPELINED_BCGSTAB:
+            case RECYCLING_GCRO:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_GMRES)
+                cout << "Pipelined GMRES is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_BCGSTAB)
+                cout << "Pipelined BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == RECYCLING_GCRO)
+                cout << "GCRO with subspace recycling is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
@@ -6455,7 +6624,19 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
           cout << "Time coefficients: {0.5, 0.5, 1, 1}" << endl;
           cout << "Function coefficients: {1/6, 1/3, 1/3, 1/6}" << endl;
           break;
+        case LOW_STORAGE_RK_EXPLICIT:
+          cout << "Low-storage Runge-Kutta explicit method for the flow equations." << endl;
+          switch (Kind_LowStorageRK) {
+            case LSRK3_WILLIAMSON:        cout << "3 stage, 3rd order, scheme of Williamson." << endl; break;
+            case LSRK4_CARPENTER_KENNEDY: cout << "5 stage, 4th order, scheme of Carpenter and Kennedy." << endl; break;
+            case SSP_RK2:                 cout << "2 stage, 2nd order, SSP scheme." << endl; break;
+            case SSP_RK3:                 cout << "3 stage, 3rd order, SSP scheme." << endl; break;
+          }
+          break;
       }
+      if (ResSmoothing_Coeff > 0.0)
+        cout << "Implicit residual smoothing, coefficient: " << ResSmoothing_Coeff
+             << ", Jacobi sweeps: " << ResSmoothing_Iter << "." << endl;
     }
 
     if (fea) {
@@ -6484,6 +6665,11 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
+            case PIPELINED_CG:
+              cout << "A pipelined Conjugate Gradient method is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
           }
           break;
       }
@@ -6725,16 +6911,22 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
     if (Visualize_Surface_Def) cout << "A file will be created to visualize the surface deformation." << endl;
     if (Visualize_Volume_Def) cout << "A file will be created to visualize the volume deformation." << endl;
     else cout << "No file for visualizing the deformation." << endl;
-    switch (GetDeform_Stiffness_Type()) {
-      case INVERSE_VOLUME:
-        cout << "Cell stiffness scaled by inverse of the cell volume." << endl;
-        break;
-      case SOLID_WALL_DISTANCE:
-        cout << "Cell stiffness scaled by distance to nearest solid surface." << endl;
-        break;
-      case CONSTANT_STIFFNESS:
-        cout << "Imposing constant cell stiffness." << endl;
-        break;
+    if (Deform_Method == IDW_DEFORM) {
+      cout << "Volume deformation by inverse distance weighting of the " << Deform_IDW_Neighbors
+           << " nearest boundary points." << endl;
+    }
+    else {
+      switch (GetDeform_Stiffness_Type()) {
+        case INVERSE_VOLUME:
+          cout << "Cell stiffness scaled by inverse of the cell volume." << endl;
+          break;
+        case SOLID_WALL_DISTANCE:
+          cout << "Cell stiffness scaled by distance to nearest solid surface." << endl;
+          break;
+        case CONSTANT_STIFFNESS:
+          cout << "Imposing constant cell stiffness." << endl;
+          break;
+      }
     }
   }
 
@@ -9527,31 +9719,36 @@ void CConfig::GEMM_Tock(double val_start_time, int M, int N, int K) const {
   /* Compute the elapsed time. */
   const double val_elapsed_time = val_stop_time - val_start_time;
 
-  /* Create the CLong3T from the M-N-K values and check if it is already
-     stored in the map GEMM_Profile_MNK. */
-  CLong3T MNK(M, N, K);
-  map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
+  /* The gemm calls may be carried out by several OpenMP threads, hence
+     the profiling data is updated in a critical section. */
+  SU2_OMP_CRITICAL
+  {
+    /* Create the CLong3T from the M-N-K values and check if it is already
+       stored in the map GEMM_Profile_MNK. */
+    CLong3T MNK(M, N, K);
+    map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
 
-  if(MI == GEMM_Profile_MNK.end()) {
+    if(MI == GEMM_Profile_MNK.end()) {
 
-    /* Entry is not present yet. Create it. */
-    const int ind = GEMM_Profile_MNK.size();
-    GEMM_Profile_MNK[MNK] = ind;
+      /* Entry is not present yet. Create it. */
+      const int ind = GEMM_Profile_MNK.size();
+      GEMM_Profile_MNK[MNK] = ind;
 
-    GEMM_Profile_NCalls.push_back(1);
-    GEMM_Profile_TotTime.push_back(val_elapsed_time);
-    GEMM_Profile_MinTime.push_back(val_elapsed_time);
-    GEMM_Profile_MaxTime.push_back(val_elapsed_time);
-  }
-  else {
+      GEMM_Profile_NCalls.push_back(1);
+      GEMM_Profile_TotTime.push_back(val_elapsed_time);
+      GEMM_Profile_MinTime.push_back(val_elapsed_time);
+      GEMM_Profile_MaxTime.push_back(val_elapsed_time);
+    }
+    else {
 
-    /* Entry is already present. Determine its index in the
-       map and update the corresponding vectors. */
-    const int ind = MI->second;
-    ++GEMM_Profile_NCalls[ind];
-    GEMM_Profile_TotTime[ind] += val_elapsed_time;
-    GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], val_elapsed_time);
-    GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
+      /* Entry is already present. Determine its index in the
+         map and update the corresponding vectors. */
+      const int ind = MI->second;
+      ++GEMM_Profile_NCalls[ind];
+      GEMM_Profile_TotTime[ind] += val_elapsed_time;
+      GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], val_elapsed_time);
+      GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
+    }
   }
 
 #endif
@@ -28,12 +28,116 @@
 #include "../../include/adt/CADTElemClass.hpp"
 #include "../../include/mpi_structure.hpp"
 #include "../../include/option_structure.hpp"
+#include "../../include/parallelization/vectorization.hpp"
 
 /* Define the tolerance to decide whether or not a point is inside an element. */
 const su2double tolInsideElem   =  1.e-10;
 const su2double paramLowerBound = -1.0 - tolInsideElem;
 const su2double paramUpperBound =  1.0 + tolInsideElem;
 
+namespace {
+
+/*--- SIMD type used to compute the distance to several elements simultaneously. ---*/
+using SimdDouble = simd::Array<passivedouble>;
+
+/*!
+ * \brief Branch free version of CADTElemClass::Dist2ToLine, for nDim-dimensional segments Xa-Xb.
+ */
+template<size_t nDim>
+FORCEINLINE SimdDouble Dist2ToSegmentSIMD(const SimdDouble *P, const SimdDouble *Xa, const SimdDouble *Xb) {
+
+  SimdDouble V0[nDim], V1[nDim], dotV0V1 = 0.0, dotV1V1 = 0.0;
+  for(size_t k=0; k<nDim; ++k) {
+    V0[k] = P[k] - 0.5*(Xb[k] + Xa[k]);
+    V1[k] =        0.5*(Xb[k] - Xa[k]);
+    dotV0V1 += V0[k]*V1[k];
+    dotV1V1 += V1[k]*V1[k];
+  }
+
+  /* Degenerate segments give r = 0 instead of NaN. */
+  SimdDouble r = dotV0V1 / (dotV1V1 + (dotV1V1 == 0.0));
+  r = max(-1.0, min(1.0, r));
+
+  SimdDouble dist2 = 0.0;
+  for(size_t k=0; k<nDim; ++k) {
+    const SimdDouble ds = V0[k] - r*V1[k];
+    dist2 += ds*ds;
+  }
+  return dist2;
+}
+
+/*!
+ * \brief Branch free version of the distance computation of CADTElemClass::Dist2ToElement for triangles.
+ */
+FORCEINLINE SimdDouble Dist2ToTriangleSIMD(const SimdDouble *P, const SimdDouble *X0,
+                                           const SimdDouble *X1, const SimdDouble *X2) {
+  constexpr size_t nDim = 3;
+
+  /*--- Projection on the plane of the triangle, see Dist2ToTriangle. ---*/
+  SimdDouble V0[nDim], V1[nDim], V2[nDim];
+  SimdDouble dotV0V1 = 0.0, dotV0V2 = 0.0, dotV1V1 = 0.0, dotV1V2 = 0.0, dotV2V2 = 0.0;
+  for(size_t k=0; k<nDim; ++k) {
+    V0[k] = P[k] - 0.5*(X1[k] + X2[k]);
+    V1[k] =        0.5*(X1[k] - X0[k]);
+    V2[k] =        0.5*(X2[k] - X0[k]);
+    dotV0V1 += V0[k]*V1[k];
+    dotV0V2 += V0[k]*V2[k];
+    dotV1V1 += V1[k]*V1[k];
+    dotV1V2 += V1[k]*V2[k];
+    dotV2V2 += V2[k]*V2[k];
+  }
+
+  const SimdDouble det = dotV1V1*dotV2V2 - dotV1V2*dotV1V2;
+  const SimdDouble detInv = 1.0 / (det + (det == 0.0));
+  const SimdDouble r = detInv*(dotV0V1*dotV2V2 - dotV0V2*dotV1V2);
+  const SimdDouble s = detInv*(dotV0V2*dotV1V1 - dotV0V1*dotV1V2);
+
+  SimdDouble dist2Proj = 0.0;
+  for(size_t k=0; k<nDim; ++k) {
+    const SimdDouble ds = V0[k] - r*V1[k] - s*V2[k];
+    dist2Proj += ds*ds;
+  }
+
+  /*--- Distance to the edges, used when the projection is outside the triangle. ---*/
+  const SimdDouble dist2Edge = min(Dist2ToSegmentSIMD<nDim>(P, X0, X1),
+                               min(Dist2ToSegmentSIMD<nDim>(P, X1, X2),
+                                   Dist2ToSegmentSIMD<nDim>(P, X2, X0)));
+
+  /*--- Blend with a mask (0 or 1) of the projections inside non degenerate triangles. ---*/
+  const passivedouble lowerBound = SU2_TYPE::GetValue(paramLowerBound);
+  const passivedouble upperBound = SU2_TYPE::GetValue(tolInsideElem);
+
+  const SimdDouble inside = (r >= lowerBound) * (s >= lowerBound) * ((r+s) <= upperBound) * (det != 0.0);
+
+  return inside*dist2Proj + (1.0-inside)*dist2Edge;
+}
+
+/*!
+ * \brief Key of a point on a Morton (Z-order) curve in the box [lo,hi].
+ */
+uint64_t MortonKey(const su2double *coor, const su2double *lo, const su2double *hi, unsigned short nDim) {
+
+  const unsigned short nBits = 63 / nDim;
+  const passivedouble maxInt = (uint64_t(1) << nBits) - 1;
+
+  uint64_t iCoor[3] = {0, 0, 0};
+  for(unsigned short k=0; k<nDim; ++k) {
+    const passivedouble len = max(SU2_TYPE::GetValue(hi[k] - lo[k]), 1e-300);
+    const passivedouble t = SU2_TYPE::GetValue(coor[k] - lo[k]) / len;
+    iCoor[k] = static_cast<uint64_t>(min(max(t, 0.0), 1.0) * maxInt);
+  }
+
+  /* Interleave the bits of the integer coordinates. */
+  uint64_t key = 0;
+  for(int iBit=nBits-1; iBit>=0; --iBit)
+    for(unsigned short k=0; k<nDim; ++k)
+      key = (key << 1) | ((iCoor[k] >> iBit) & 1);
+
+  return key;
+}
+
+} // namespace
+
 CADTElemClass::CADTElemClass(unsigned short         val_nDim,
                              vector<su2double>      &val_coor,
                              vector<unsigned long>  &val_connElem,
@@ -354,6 +458,7 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
                                                  vector<unsigned long>& frontLeaves,
                                                  vector<unsigned long>& frontLeavesNew,
                                                  const su2double *coor,
+                                                 unsigned long   &iElemADT,
                                                  su2double       &dist,
                                                  unsigned short  &markerID,
                                                  unsigned long   &elemID,
@@ -378,6 +483,20 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
   if(nDim==3) {
   ds = max(fabs(coor[2]-coorBBMin[2]), fabs(coor[2]-coorBBMax[2])); dist += ds*ds;}
 
+  /*--- If a guess for the nearest element is given, its distance (squared) is
+        an upper bound for the minimum distance, which reduces the number of
+        bounding boxes to be considered in the tree traversal. ---*/
+  if(iElemADT < localElemIDs.size()) {
+    su2double dist2Guess;
+    Dist2ToElement(iElemADT, coor, dist2Guess);
+
+    jj       = iElemADT;
+    dist     = min(dist, dist2Guess);
+    markerID = localMarkers[jj];
+    elemID   = localElemIDs[jj];
+    rankID   = ranksOfElems[jj];
+  }
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 2: Traverse the tree and store the bounding boxes for which the ---*/
   /*---         possible minimum distance is less than the currently stored  ---*/
@@ -495,6 +614,41 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
      candidates are checked first. */
   sort(BBoxTargets.begin(), BBoxTargets.end());
 
+  /*--- Lambda to overwrite the return information of this function if the
+        distance squared to an element is less than or equal to the current value.
+        The equal is necessary to avoid problems for extreme situations. ---*/
+  auto UpdateNearest = [&](const unsigned long ii, const su2double dist2Elem) {
+    if(dist2Elem <= dist) {
+      jj       = ii;
+      dist     = dist2Elem;
+      markerID = localMarkers[ii];
+      elemID   = localElemIDs[ii];
+      rankID   = ranksOfElems[ii];
+    }
+  };
+
+  /*--- Lines (2D) and triangles (3D) are gathered in groups of the SIMD length,
+        the distances to the elements of a group are computed simultaneously.
+        A pending group is processed before any other element is checked, hence
+        the candidates are applied in the same order as in a one by one check.
+        Delaying the update of dist only makes the break test below less strict,
+        the extra candidates cannot be closer. The vectorized kernel can differ
+        from Dist2ToElement by roundoff, hence in (near) ties another element
+        with the same distance may be selected. The returned distance is always
+        recomputed with Dist2ToElement. ---*/
+  constexpr unsigned short simdLen = SimdDouble::Size;
+  const unsigned short simplexType = (nDim == 2)? LINE : TRIANGLE;
+  unsigned long  groupIDs[simdLen];
+  su2double      groupDist2[simdLen];
+  unsigned short nGroup = 0;
+
+  auto ProcessGroup = [&]() {
+    if(nGroup == 0) return;
+    Dist2ToSimplices(nGroup, groupIDs, coor, groupDist2);
+    for(unsigned short k=0; k<nGroup; ++k) UpdateNearest(groupIDs[k], groupDist2[k]);
+    nGroup = 0;
+  };
+
   /* Loop over the candidate bounding boxes. */
   for(unsigned long i=0; i<BBoxTargets.size(); ++i) {
 
@@ -506,21 +660,21 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
     if(BBoxTargets[i].possibleMinDist2 > dist) break;
 
     /*--- Compute the distance squared to the element that corresponds to the
-          current bounding box. If this distance is less than or equal to
-          the current value, overwrite the return information of this function.
-          The equal is necessary to avoid problems for extreme situations. ---*/
+          current bounding box, or add it to the group of simplices. ---*/
     const unsigned long ii = BBoxTargets[i].boundingBoxID;
 
-    su2double dist2Elem;
-    Dist2ToElement(ii, coor, dist2Elem);
-    if(dist2Elem <= dist) {
-      jj       = ii;
-      dist     = dist2Elem;
-      markerID = localMarkers[ii];
-      elemID   = localElemIDs[ii];
-      rankID   = ranksOfElems[ii];
+    if(elemVTK_Type[ii] == simplexType) {
+      groupIDs[nGroup++] = ii;
+      if(nGroup == simdLen) ProcessGroup();
+    }
+    else {
+      ProcessGroup();
+      su2double dist2Elem;
+      Dist2ToElement(ii, coor, dist2Elem);
+      UpdateNearest(ii, dist2Elem);
     }
   }
+  ProcessGroup();
 
   AD::EndPassive(wasActive);
 
@@ -528,6 +682,64 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
      the correct value. */
   Dist2ToElement(jj, coor, dist);
   dist = sqrt(dist);
+  iElemADT = jj;
+}
+
+void CADTElemClass::DetermineNearestElements(const su2activematrix  &coor,
+                                             vector<unsigned long>  &iElemADT,
+                                             vector<su2double>      &dist,
+                                             vector<unsigned short> &markerID,
+                                             vector<unsigned long>  &elemID,
+                                             vector<int>            &rankID) {
+
+  const unsigned long nPoints = coor.rows();
+  const unsigned long nElem = localElemIDs.size();
+
+  /* Allocate the memory of the return information, no guess is used if none is given. */
+  if(iElemADT.size() != nPoints) iElemADT.assign(nPoints, nElem);
+  dist.resize(nPoints);
+  markerID.resize(nPoints);
+  elemID.resize(nPoints);
+  rankID.resize(nPoints);
+  if(nPoints == 0) return;
+
+  /*--- The bounding box of the root leaf is used to map the points on a Morton curve.
+        Sorting the points along this curve makes consecutive searches spatially
+        coherent, i.e. they visit the same leaves and have similar nearest elements. ---*/
+  const su2double *coorMin = leaves[0].xMin;
+  const su2double *coorMax = leaves[0].xMax + nDim;
+
+  vector<pair<uint64_t, unsigned long> > curveOrder(nPoints);
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(roundUpDiv(nPoints, omp_get_num_threads()))
+    for(unsigned long iPoint=0; iPoint<nPoints; ++iPoint)
+      curveOrder[iPoint] = make_pair(MortonKey(coor[iPoint], coorMin, coorMax, nDim), iPoint);
+
+    SU2_OMP_MASTER
+    sort(curveOrder.begin(), curveOrder.end());
+    SU2_OMP_BARRIER
+
+    /*--- Each thread processes chunks of consecutive points along the curve, with its own
+          working variables. When no guess is given for a point, the nearest element of
+          the previous point is used as initial guess. ---*/
+    const int iThread = omp_get_thread_num();
+    unsigned long iElemPrev = nElem;
+
+    SU2_OMP_FOR_DYN(roundUpDiv(nPoints, 8*omp_get_num_threads()))
+    for(unsigned long i=0; i<nPoints; ++i) {
+      const unsigned long iPoint = curveOrder[i].second;
+
+      if(iElemADT[iPoint] >= nElem) iElemADT[iPoint] = iElemPrev;
+
+      DetermineNearestElement_impl(BBoxTargets[iThread], FrontLeaves[iThread], FrontLeavesNew[iThread],
+                                   coor[iPoint], iElemADT[iPoint], dist[iPoint], markerID[iPoint],
+                                   elemID[iPoint], rankID[iPoint]);
+      iElemPrev = iElemADT[iPoint];
+    }
+  }
+  // end SU2_OMP_PARALLEL
 }
 
 bool CADTElemClass::CoorInElement(const unsigned long elemID,
@@ -643,6 +855,32 @@ void CADTElemClass::Dist2ToElement(const unsigned long elemID,
   }
 }
 
+void CADTElemClass::Dist2ToSimplices(const unsigned short nElem,
+                                     const unsigned long  *elemIDs,
+                                     const su2double      *coor,
+                                     su2double            *dist2) const {
+
+  /*--- Gather the coordinates of the vertices (nDim for lines in 2D and triangles in 3D)
+        of the elements, the unused lanes repeat the last element. ---*/
+  SimdDouble P[3], X[3][3];
+  for(unsigned short iDim=0; iDim<nDim; ++iDim)
+    P[iDim] = SU2_TYPE::GetValue(coor[iDim]);
+
+  for(size_t k=0; k<SimdDouble::Size; ++k) {
+    const unsigned long ii = elemIDs[min<size_t>(k, nElem-1)];
+    for(unsigned short iVert=0; iVert<nDim; ++iVert) {
+      const unsigned long i0 = nDim*elemConns[nDOFsPerElem[ii]+iVert];
+      for(unsigned short iDim=0; iDim<nDim; ++iDim)
+        X[iVert][iDim][k] = SU2_TYPE::GetValue(coorPoints[i0+iDim]);
+    }
+  }
+
+  const SimdDouble dist2Simd = (nDim == 2)? Dist2ToSegmentSIMD<2>(P, X[0], X[1]) :
+                                            Dist2ToTriangleSIMD(P, X[0], X[1], X[2]);
+
+  for(unsigned short k=0; k<nElem; ++k) dist2[k] = dist2Simd[k];
+}
+
 bool CADTElemClass::CoorInTriangle(const unsigned long elemID,
                                    const su2double     *coor,
                                    su2double           *parCoor,
@@ -253,3 +253,146 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
   dist = sqrt(dist);
 
 }
+
+void CADTPointsOnlyClass::DetermineNearestNodes_impl(vector<unsigned long>& frontLeaves,
+                                                     vector<unsigned long>& frontLeavesNew,
+                                                     const su2double       *coor,
+                                                     const unsigned long   nNodes,
+                                                     vector<su2double>     &dist,
+                                                     vector<unsigned long> &pointID,
+                                                     vector<int>           &rankID) const {
+
+  /* Determine the number of nodes that can actually be returned. */
+  const unsigned long nNearest = min(nNodes, (unsigned long) localPointIDs.size());
+
+  dist.clear();
+  pointID.clear();
+  rankID.clear();
+  if(nNearest == 0) return;
+
+  const bool wasActive = AD::BeginPassive();
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Define the function to update the list of candidates. This ---*/
+  /*---         list is sorted in increasing order of the distance squared ---*/
+  /*---         and contains at most nNearest nodes. During the search the ---*/
+  /*---         indices in coorPoints are stored in pointID. Ties are      ---*/
+  /*---         broken with the local point ID, such that the result does  ---*/
+  /*---         not depend on the order of the traversal.                  ---*/
+  /*--------------------------------------------------------------------------*/
+
+  auto isCloser = [&](const su2double d0, const unsigned long k0,
+                      const su2double d1, const unsigned long k1) {
+    if(d0 != d1) return d0 < d1;
+    return localPointIDs[k0] < localPointIDs[k1];
+  };
+
+  auto updateCandidates = [&](const unsigned long kk) {
+
+    const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
+    su2double distTarget = 0;
+    for(unsigned short l=0; l<nDimADT; ++l) {
+      const su2double ds = coor[l] - coorTarget[l];
+      distTarget += ds*ds;
+    }
+
+    /* Return if the list is full and this node is not closer than the last one. */
+    if((dist.size() == nNearest) && !isCloser(distTarget, kk, dist.back(), pointID.back()))
+      return;
+
+    /* Return if the node is already present, because the central nodes of the
+       leaves are visited more than once. */
+    for(unsigned long i=0; i<pointID.size(); ++i)
+      if(pointID[i] == kk) return;
+
+    /* Insert the node at the correct position and remove the last
+       one if too many nodes are stored. */
+    unsigned long pos = dist.size();
+    while((pos > 0) && isCloser(distTarget, kk, dist[pos-1], pointID[pos-1])) --pos;
+
+    dist.insert(dist.begin()+pos, distTarget);
+    pointID.insert(pointID.begin()+pos, kk);
+
+    if(dist.size() > nNearest) {
+      dist.pop_back();
+      pointID.pop_back();
+    }
+  };
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Traverse the tree and search for the nearest nodes. A leaf ---*/
+  /*---         must be searched if its possible minimum distance squared  ---*/
+  /*---         does not exceed the distance squared of the last candidate.---*/
+  /*--------------------------------------------------------------------------*/
+
+  updateCandidates(leaves[0].centralNodeID);
+
+  frontLeaves.clear();
+  frontLeaves.push_back(0);
+
+  for(;;) {
+
+    frontLeavesNew.clear();
+
+    for(unsigned long i=0; i<frontLeaves.size(); ++i) {
+
+      const unsigned long ll = frontLeaves[i];
+      for(unsigned short mm=0; mm<2; ++mm) {
+
+        const unsigned long kk = leaves[ll].children[mm];
+        if( leaves[ll].childrenAreTerminal[mm] ) {
+
+          /* Child contains a node. Update the candidates. */
+          updateCandidates(kk);
+        }
+        else {
+
+          /*--- Child contains a leaf. Determine the possible minimum distance
+                squared to that leaf and check if it must be searched. In that
+                case the central node of the leaf is used to update the
+                candidates, which reduces the search radius. ---*/
+          su2double posDist = 0.0;
+          for(unsigned short l=0; l<nDimADT; ++l) {
+            su2double ds = 0.0;
+            if(     coor[l] < leaves[kk].xMin[l]) ds = coor[l] - leaves[kk].xMin[l];
+            else if(coor[l] > leaves[kk].xMax[l]) ds = coor[l] - leaves[kk].xMax[l];
+
+            posDist += ds*ds;
+          }
+
+          if((dist.size() < nNearest) || (posDist <= dist.back())) {
+            frontLeavesNew.push_back(kk);
+            updateCandidates(leaves[kk].centralNodeID);
+          }
+        }
+      }
+    }
+
+    frontLeaves = frontLeavesNew;
+    if(frontLeaves.size() == 0) break;
+  }
+
+  AD::EndPassive(wasActive);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Recompute the distances, such that the correct dependency  ---*/
+  /*---         is obtained when AD is used, and convert the indices to    ---*/
+  /*---         the local point IDs and ranks.                             ---*/
+  /*--------------------------------------------------------------------------*/
+
+  rankID.resize(nNearest);
+  for(unsigned long i=0; i<nNearest; ++i) {
+    const unsigned long kk = pointID[i];
+    const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
+
+    dist[i] = 0.0;
+    for(unsigned short l=0; l<nDimADT; ++l) {
+      const su2double ds = coor[l] - coorTarget[l];
+      dist[i] += ds*ds;
+    }
+    dist[i] = sqrt(dist[i]);
+
+    pointID[i] = localPointIDs[kk];
+    rankID[i]  = ranksOfPoints[kk];
+  }
+}
@@ -28,6 +28,7 @@
 
 #include "../include/CConfig.hpp"
 #include "../include/blas_structure.hpp"
+#include "../include/parallelization/vectorization.hpp"
 #include <cstring>
 
 /* MKL or BLAS, if supported. */
@@ -66,11 +67,21 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
 #endif
 
 #if (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)) || !(defined(HAVE_LIBXSMM) || defined(HAVE_MKL) || defined(HAVE_BLAS))
-  /* Native implementation of the matrix product. This optimized implementation
-     assumes that the matrices are in column major order. This can be
-     accomplished by swapping N and M and A and B. This implementation is based
-     on https://github.com/flame/how-to-optimize-gemm. */
-  gemm_imp(N, M, K, B, A, C);
+  /* Native implementation of the matrix product. The DG solver multiplies
+     small matrices with a batch of elements stored in the columns of B, i.e.
+     N is large compared to M and K. For these shapes the vectorized kernels of
+     gemm_small are used, as long as a strip of B fits in the cache. */
+  if((N >= (int) simd::Array<su2double>::Size) && (K <= kc)) {
+    gemm_small(M, N, K, A, B, C);
+  }
+  else {
+
+    /* This optimized implementation assumes that the matrices are in column
+       major order. This can be accomplished by swapping N and M and A and B.
+       This implementation is based on
+       https://github.com/flame/how-to-optimize-gemm. */
+    gemm_imp(N, M, K, B, A, C);
+  }
 
 #else
 #ifdef HAVE_LIBXSMM
@@ -200,4 +211,91 @@ void CBlasStructure::gemm_arbitrary(int m, int n, int k, const su2double *a, int
 #undef B
 #undef A
 
+/* Matrix product for the small matrices encountered in the DG solver. */
+void CBlasStructure::gemm_small(const int m,        const int n,        const int k,
+                                const su2double *a, const su2double *b, su2double *c) {
+
+  /* Determine the vector length of the simd::Array used in the kernels. */
+  const int vecLen = simd::Array<su2double>::Size;
+
+  /* Treat the columns in strips of at most 3 vector lengths, which are
+     the widest strips that keep the accumulators of gemm_small_kernel
+     in registers for AVX2. */
+  int j = 0;
+  for(; (j+3*vecLen) <= n; j+=3*vecLen)
+    gemm_small_strip<3>(m, n, k, a, b+j, c+j);
+
+  switch( (n-j)/vecLen ) {
+    case 2: gemm_small_strip<2>(m, n, k, a, b+j, c+j); j += 2*vecLen; break;
+    case 1: gemm_small_strip<1>(m, n, k, a, b+j, c+j); j +=   vecLen; break;
+    default: break;
+  }
+
+  /* Treat the remaining columns, if any, which do not fill a vector. */
+  if(j < n) {
+    for(int i=0; i<m; ++i) {
+      su2double *cc = c + i*n;
+      for(int jj=j; jj<n; ++jj) cc[jj] = 0.0;
+
+      for(int p=0; p<k; ++p) {
+        const su2double aa = a[i*k+p];
+        const su2double *bb = b + p*n;
+        for(int jj=j; jj<n; ++jj) cc[jj] += aa*bb[jj];
+      }
+    }
+  }
+}
+
+/* Computation of a strip of NB vector lengths of columns of c. */
+template<int NB>
+void CBlasStructure::gemm_small_strip(const int m,        const int ldc,      const int k,
+                                      const su2double *a, const su2double *b, su2double *c) {
+
+  /* Treat the rows in blocks of 4, followed by the remainder. */
+  int i = 0;
+  for(; (i+4) <= m; i+=4)
+    gemm_small_kernel<4,NB>(ldc, k, a+i*k, b, c+i*ldc);
+
+  switch( m-i ) {
+    case 3: gemm_small_kernel<3,NB>(ldc, k, a+i*k, b, c+i*ldc); break;
+    case 2: gemm_small_kernel<2,NB>(ldc, k, a+i*k, b, c+i*ldc); break;
+    case 1: gemm_small_kernel<1,NB>(ldc, k, a+i*k, b, c+i*ldc); break;
+    default: break;
+  }
+}
+
+/* Register blocked kernel for a block of MB rows and NB vector lengths of c. */
+template<int MB, int NB>
+void CBlasStructure::gemm_small_kernel(const int ldc,      const int k,        const su2double *a,
+                                       const su2double *b, su2double *c) {
+
+  using VecType = simd::Array<su2double>;
+  const int vecLen = VecType::Size;
+
+  /* Initialize the accumulators to zero. */
+  VecType acc[MB][NB];
+  for(int r=0; r<MB; ++r)
+    for(int s=0; s<NB; ++s)
+      acc[r][s] = 0.0;
+
+  /* Loop over the inner dimension and update the accumulators with the
+     broadcast entries of a times the vectors of the current row of b. */
+  for(int p=0; p<k; ++p) {
+    VecType bb[NB];
+    for(int s=0; s<NB; ++s)
+      bb[s].load(b + p*ldc + s*vecLen);
+
+    for(int r=0; r<MB; ++r) {
+      const su2double aa = a[r*k+p];
+      for(int s=0; s<NB; ++s)
+        acc[r][s] += aa*bb[s];
+    }
+  }
+
+  /* Store the accumulators in c. */
+  for(int r=0; r<MB; ++r)
+    for(int s=0; s<NB; ++s)
+      acc[r][s].store(c + r*ldc + s*vecLen);
+}
+
 #endif
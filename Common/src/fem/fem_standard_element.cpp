@@ -2014,6 +2014,10 @@ CFEMStandardElement::CFEMStandardElement(unsigned short          val_VTK_Type,
     }
   }
 
+  /*--- Create the 1D data for the sum factorization of the tensor product
+        elements, if appropriate. ---*/
+  SetUpSumFactorization();
+
   /*--------------------------------------------------------------------------*/
   /*--- Create the data of the derivatives of the basis functions in the   ---*/
   /*--- solution DOFs of the element.                                      ---*/
@@ -2275,6 +2279,228 @@ void CFEMStandardElement::Copy(const CFEMStandardElement &other) {
   matDerBasisSolDOFs  = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs  = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt   = other.mat2ndDerBasisInt;
+
+  sumFactorization      = other.sumFactorization;
+  nDOFs1D               = other.nDOFs1D;
+  nIntegration1D        = other.nIntegration1D;
+  lagBasisInt1D         = other.lagBasisInt1D;
+  derLagBasisInt1D      = other.derLagBasisInt1D;
+  lagBasisInt1DTrans    = other.lagBasisInt1DTrans;
+  derLagBasisInt1DTrans = other.derLagBasisInt1DTrans;
+}
+
+unsigned int CFEMStandardElement::GetSizeWorkSumFactorization(void) const {
+
+  /* No work array is needed when sum factorization is not used. */
+  if( !sumFactorization ) return 0;
+
+  /* The work array must be able to store the data in the integration points
+     and DOFs of one direction of the fluxes plus the two intermediate results
+     of TensorProductSumFact. All of them are bounded by the maximum of the
+     number of DOFs and integration points to the power nDim. */
+  const unsigned int n1D = max(nDOFs1D, nIntegration1D);
+  if(VTK_Type == QUADRILATERAL) return 3*n1D*n1D;
+  return 4*n1D*n1D*n1D;
+}
+
+void CFEMStandardElement::InterpolateDOFsToIntegrationPoints(const int       N,
+                                                             const su2double *dataDOFs,
+                                                             su2double       *dataInt,
+                                                             su2double       *work,
+                                                             CBlasStructure  *blas,
+                                                             const CConfig   *config) const {
+  if( sumFactorization ) {
+    const su2double *lag = lagBasisInt1D.data();
+    TensorProductSumFact(N, nDOFs1D, nIntegration1D, lag, lag, lag,
+                         dataDOFs, dataInt, work, blas, config);
+  }
+  else
+    blas->gemm(nIntegration, N, nDOFs, lagBasisIntegration.data(), dataDOFs, dataInt, config);
+}
+
+void CFEMStandardElement::DataAndDerivativesIntegrationPoints(const int       N,
+                                                              const su2double *dataDOFs,
+                                                              su2double       *dataInt,
+                                                              su2double       *work,
+                                                              CBlasStructure  *blas,
+                                                              const CConfig   *config) const {
+  if( sumFactorization ) {
+
+    /* The data itself and every parametric derivative is a tensor product,
+       where the derivative of the 1D basis functions is used in the direction
+       of the derivative. */
+    const su2double *lag = lagBasisInt1D.data();
+    const su2double *der = derLagBasisInt1D.data();
+    const unsigned long offset = nIntegration*N;
+
+    TensorProductSumFact(N, nDOFs1D, nIntegration1D, lag, lag, lag,
+                         dataDOFs, dataInt, work, blas, config);
+    TensorProductSumFact(N, nDOFs1D, nIntegration1D, der, lag, lag,
+                         dataDOFs, dataInt+offset, work, blas, config);
+    TensorProductSumFact(N, nDOFs1D, nIntegration1D, lag, der, lag,
+                         dataDOFs, dataInt+2*offset, work, blas, config);
+    if(VTK_Type == HEXAHEDRON)
+      TensorProductSumFact(N, nDOFs1D, nIntegration1D, lag, lag, der,
+                           dataDOFs, dataInt+3*offset, work, blas, config);
+  }
+  else {
+    const int nRows = matBasisIntegration.size()/nDOFs;
+    blas->gemm(nRows, N, nDOFs, matBasisIntegration.data(), dataDOFs, dataInt, config);
+  }
+}
+
+void CFEMStandardElement::IntegrateDataIntegrationPoints(const int       N,
+                                                         const su2double *dataInt,
+                                                         su2double       *dataDOFs,
+                                                         su2double       *work,
+                                                         CBlasStructure  *blas,
+                                                         const CConfig   *config) const {
+  if( sumFactorization ) {
+    const su2double *lagT = lagBasisInt1DTrans.data();
+    TensorProductSumFact(N, nIntegration1D, nDOFs1D, lagT, lagT, lagT,
+                         dataInt, dataDOFs, work, blas, config);
+  }
+  else
+    blas->gemm(nDOFs, N, nIntegration, lagBasisIntegrationTrans.data(), dataInt, dataDOFs, config);
+}
+
+void CFEMStandardElement::IntegrateFluxesIntegrationPoints(const int       N,
+                                                           const su2double *fluxes,
+                                                           su2double       *res,
+                                                           su2double       *work,
+                                                           CBlasStructure  *blas,
+                                                           const CConfig   *config) const {
+  /* Determine the number of parametric dimensions. */
+  const unsigned short nDimPar = (VTK_Type == HEXAHEDRON) ? 3 : 2;
+
+  if( sumFactorization ) {
+
+    /* Set the pointers for the flux in one parametric direction, its
+       contribution to the residual and the work array of the tensor products. */
+    su2double *fluxDir    = work;
+    su2double *resDir     = fluxDir + nIntegration*N;
+    su2double *workTensor = resDir  + nDOFs*N;
+
+    const su2double *lagT = lagBasisInt1DTrans.data();
+    const su2double *derT = derLagBasisInt1DTrans.data();
+
+    /* Loop over the parametric directions. */
+    for(unsigned short iDim=0; iDim<nDimPar; ++iDim) {
+
+      /* Copy the flux in this direction into contiguous memory. */
+      for(unsigned short i=0; i<nIntegration; ++i) {
+        const su2double *flux = fluxes + (i*nDimPar + iDim)*N;
+        su2double *fluxI      = fluxDir + i*N;
+        for(int j=0; j<N; ++j) fluxI[j] = flux[j];
+      }
+
+      /* Apply the tensor product, in which the transpose of the derivative
+         of the 1D basis functions is used in the direction iDim. The first
+         direction is stored in res directly, the others are added. */
+      su2double *resTensor = iDim ? resDir : res;
+      TensorProductSumFact(N, nIntegration1D, nDOFs1D,
+                           iDim == 0 ? derT : lagT, iDim == 1 ? derT : lagT,
+                           iDim == 2 ? derT : lagT, fluxDir, resTensor,
+                           workTensor, blas, config);
+
+      if( iDim ) {
+        for(unsigned long i=0; i<(unsigned long)(nDOFs*N); ++i)
+          res[i] += resDir[i];
+      }
+    }
+  }
+  else
+    blas->gemm(nDOFs, N, nIntegration*nDimPar, matDerBasisIntTrans.data(), fluxes, res, config);
+}
+
+void CFEMStandardElement::SetUpSumFactorization(void) {
+
+  /* Sum factorization is only possible for quadrilaterals and hexahedra,
+     for which both the DOFs and the integration points are tensor products
+     of 1D distributions with the r-index running fastest. For linear
+     elements the dense matrix product is cheaper than the sequence of
+     small products of the sum factorization. */
+  nDOFs1D = nIntegration1D = 0;
+  sumFactorization = ((VTK_Type == QUADRILATERAL) || (VTK_Type == HEXAHEDRON))
+                  && (nPoly > 1);
+  if( !sumFactorization ) return;
+
+  /* Determine the number of 1D integration points, see IntegrationPointsQuadrilateral
+     and IntegrationPointsHexahedron, and check if this is consistent. */
+  nIntegration1D = orderExact/2 + 1;
+  const unsigned short nDimPar = (VTK_Type == HEXAHEDRON) ? 3 : 2;
+  if(pow(nIntegration1D, nDimPar) != nIntegration)
+    SU2_MPI::Error("Integration points are not a tensor product. This should not happen",
+                   CURRENT_FUNCTION);
+
+  /* The first nIntegration1D r-coordinates are the 1D integration points.
+     Compute the 1D Lagrangian basis functions and their derivatives in
+     these points. */
+  vector<su2double> r1D(rIntegration.begin(), rIntegration.begin()+nIntegration1D);
+  vector<su2double> rDOFs1D, matVandermondeInv1D;
+
+  LagrangianBasisFunctionAndDerivativesLine(nPoly, r1D, nDOFs1D, rDOFs1D,
+                                            matVandermondeInv1D, lagBasisInt1D,
+                                            derLagBasisInt1D);
+  CheckSumLagrangianBasisFunctions(nIntegration1D, nDOFs1D, lagBasisInt1D);
+
+  /* Create the transposes, which are needed for the integration
+     of the residual. */
+  lagBasisInt1DTrans.resize(lagBasisInt1D.size());
+  derLagBasisInt1DTrans.resize(derLagBasisInt1D.size());
+
+  unsigned int ii = 0;
+  for(unsigned short j=0; j<nDOFs1D; ++j) {
+    for(unsigned short i=0; i<nIntegration1D; ++i, ++ii) {
+      lagBasisInt1DTrans[ii]    = lagBasisInt1D[i*nDOFs1D+j];
+      derLagBasisInt1DTrans[ii] = derLagBasisInt1D[i*nDOFs1D+j];
+    }
+  }
+}
+
+void CFEMStandardElement::TensorProductSumFact(const int       N,
+                                               const int       nIn1D,
+                                               const int       nOut1D,
+                                               const su2double *Ar,
+                                               const su2double *As,
+                                               const su2double *At,
+                                               const su2double *dataIn,
+                                               su2double       *dataOut,
+                                               su2double       *work,
+                                               CBlasStructure  *blas,
+                                               const CConfig   *config) const {
+
+  /* The data is stored with the r-index running fastest, followed by s and t,
+     and every entry consists of N columns. Hence the slowest running index can
+     be treated with one matrix product and the faster ones with a sequence of
+     matrix products on contiguous slices. */
+  if(VTK_Type == QUADRILATERAL) {
+
+    /* s-direction, followed by the r-direction for every output s-index. */
+    su2double *tmp = work;
+    blas->gemm(nOut1D, nIn1D*N, nIn1D, As, dataIn, tmp, config);
+
+    for(int j=0; j<nOut1D; ++j)
+      blas->gemm(nOut1D, N, nIn1D, Ar, tmp + j*nIn1D*N,
+                 dataOut + j*nOut1D*N, config);
+  }
+  else {
+
+    /* t-direction in one product. */
+    su2double *tmpT  = work;
+    su2double *tmpST = tmpT + nOut1D*nIn1D*nIn1D*N;
+    blas->gemm(nOut1D, nIn1D*nIn1D*N, nIn1D, At, dataIn, tmpT, config);
+
+    /* s-direction for every output t-index. */
+    for(int k=0; k<nOut1D; ++k)
+      blas->gemm(nOut1D, nIn1D*N, nIn1D, As, tmpT + k*nIn1D*nIn1D*N,
+                 tmpST + k*nOut1D*nIn1D*N, config);
+
+    /* r-direction for every output s- and t-index. */
+    for(int jk=0; jk<(nOut1D*nOut1D); ++jk)
+      blas->gemm(nOut1D, N, nIn1D, Ar, tmpST + jk*nIn1D*N,
+                 dataOut + jk*nOut1D*N, config);
+  }
 }
 
 void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
@@ -172,7 +172,14 @@ void CMeshFEM_DG::SetWallDistance(su2double val){
   }
 }
 
-void CMeshFEM_DG::SetWallDistance(const CConfig *config, CADTElemClass *WallADT){
+void CMeshFEM_DG::SetWallDistance(const CConfig *config, CADTElemClass *WallADT,
+                                  unsigned short iZoneADT, su2double maxWallDisp){
+
+  /*--- The searches are independent, they are distributed over the threads with a
+        dynamic schedule, as their cost depends strongly on the position. The
+        incremental update (iZoneADT, maxWallDisp) is not used for the DG mesh. ---*/
+  SU2_OMP_PARALLEL
+  {
 
   /*--------------------------------------------------------------------------*/
   /*--- Step 3: Determine the wall distance of the integration points of   ---*/
@@ -181,6 +188,7 @@ void CMeshFEM_DG::SetWallDistance(const CConfig *config, CADTElemClass *WallADT)
 
   /*--- Loop over the owned elements to compute the wall distance
         in the integration points. ---*/
+  SU2_OMP_FOR_DYN(roundUpDiv(nVolElemOwned,4*omp_get_max_threads()))
   for(unsigned long l=0; l<nVolElemOwned; ++l) {
 
     /* Get the required data from the corresponding standard element. */
@@ -215,6 +223,7 @@ void CMeshFEM_DG::SetWallDistance(const CConfig *config, CADTElemClass *WallADT)
 
   /*--- Loop over the owned elements to compute the wall distance
         in the integration points. ---*/
+  SU2_OMP_FOR_DYN(roundUpDiv(nVolElemOwned,4*omp_get_max_threads()))
   for(unsigned long l=0; l<nVolElemOwned; ++l) {
 
     /* Store the number of solDOFS a bit easier. */
@@ -246,6 +255,7 @@ void CMeshFEM_DG::SetWallDistance(const CConfig *config, CADTElemClass *WallADT)
   /*---         the internal matching faces.                               ---*/
   /*--------------------------------------------------------------------------*/
 
+  SU2_OMP_FOR_DYN(roundUpDiv(matchingFaces.size(),4*omp_get_max_threads()))
   for(unsigned long l=0; l<matchingFaces.size(); ++l) {
 
     /* Get the required data from the corresponding standard element. */
@@ -291,6 +301,7 @@ void CMeshFEM_DG::SetWallDistance(const CConfig *config, CADTElemClass *WallADT)
       /* Loop over the boundary faces and determine the wall distances
          in the integration points. */
       vector<CSurfaceElementFEM> &surfElem = boundaries[iMarker].surfElem;
+      SU2_OMP_FOR_DYN(roundUpDiv(surfElem.size(),4*omp_get_max_threads()))
       for(unsigned long l=0; l<surfElem.size(); ++l) {
 
         /* Get the required data from the corresponding standard element. */
@@ -327,4 +338,6 @@ void CMeshFEM_DG::SetWallDistance(const CConfig *config, CADTElemClass *WallADT)
       }
     }
   }
+  }
+  // end SU2_OMP_PARALLEL
 }
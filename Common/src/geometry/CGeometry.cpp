@@ -628,6 +628,10 @@ void CGeometry::GetCommCountAndType(const CConfig* config,
       COUNT_PER_POINT  = 1;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case CONTROL_VOLUME:
+      COUNT_PER_POINT  = 1;
+      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      break;
     case NEIGHBORS:
       COUNT_PER_POINT  = 1;
       MPI_TYPE         = COMM_TYPE_UNSIGNED_SHORT;
@@ -727,6 +731,9 @@ void CGeometry::InitiateComms(CGeometry *geometry,
         case MAX_LENGTH:
           bufDSend[buf_offset] = nodes->GetMaxLength(iPoint);
           break;
+        case CONTROL_VOLUME:
+          bufDSend[buf_offset] = nodes->GetVolume(iPoint);
+          break;
         case NEIGHBORS:
           bufSSend[buf_offset] = geometry->nodes->GetnNeighbor(iPoint);
           break;
@@ -830,6 +837,9 @@ void CGeometry::CompleteComms(CGeometry *geometry,
         case MAX_LENGTH:
           nodes->SetMaxLength(iPoint, bufDRecv[buf_offset]);
           break;
+        case CONTROL_VOLUME:
+          nodes->SetVolume(iPoint, bufDRecv[buf_offset]);
+          break;
         case NEIGHBORS:
           nodes->SetnNeighbor(iPoint, bufSRecv[buf_offset]);
           break;
@@ -1778,7 +1788,10 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
                                        vector<su2double> &Zcoord_Airfoil, vector<su2double> &Variable_Airfoil,
                                        bool original_surface, CConfig *config) {
 
-  const bool wasActive = AD::BeginPassive();
+  /*--- The sections are only recorded by SU2_GEO, where they are the input of the
+   geometrical functions differentiated with respect to the design variables. ---*/
+
+  const bool wasActive = (config->GetKind_SU2() != SU2_GEO) && AD::BeginPassive();
 
   unsigned short iMarker, iNode, jNode, iDim, Index = 0;
   bool intersect;
@@ -2556,6 +2569,7 @@ void CGeometry::UpdateGeometry(CGeometry **geometry_container, CConfig *config)
     geometry_container[iMesh]->SetControlVolume(config,geometry_container[iMesh-1], UPDATE);
     geometry_container[iMesh]->SetBoundControlVolume(config,geometry_container[iMesh-1], UPDATE);
     geometry_container[iMesh]->SetCoord(geometry_container[iMesh-1]);
+    geometry_container[iMesh]->SetHaloControlVolume(config);
 
   }
 
@@ -3958,6 +3972,25 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
         geometry->SetWallDistance(numeric_limits<su2double>::max());
     }
 
+    /*--- Decide if the wall distance can be updated incrementally, which requires a reference
+     * (from a previous full computation) in all zones. The maximum displacement of the walls
+     * since then bounds the change of the distance to the previous nearest wall elements. ---*/
+    const bool allowIncremental = (config_container[ZONE_0]->GetWallDistance_UpdateTol() > 0.0) &&
+                                  !config_container[ZONE_0]->GetDiscrete_Adjoint();
+    bool incremental = allowIncremental;
+    passivedouble maxLocal[] = {0.0, 0.0}, maxGlobal[] = {0.0, 0.0};
+
+    for (int iZone = 0; incremental && iZone < nZone; iZone++){
+      su2double zoneDisp = 0.0;
+      incremental = geometry_container[iZone][iInst][MESH_0]->GetMaxWallDisplacement(config_container[iZone], zoneDisp);
+      maxLocal[0] = max(maxLocal[0], SU2_TYPE::GetValue(zoneDisp));
+    }
+    /*--- The second entry flags ranks without reference, all ranks must take the same path. ---*/
+    maxLocal[1] = incremental? 0.0 : 1.0;
+    SelectMPIWrapper<passivedouble>::W::Allreduce(maxLocal, maxGlobal, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    incremental = (maxGlobal[1] == 0.0);
+    const su2double maxWallDisp = incremental? maxGlobal[0] : -1.0;
+
     /*--- Loop over all zones and compute the ADT based on the viscous walls in that zone ---*/
     for (int iZone = 0; iZone < nZone; iZone++){
       CGeometry *geometry = geometry_container[iZone][iInst][MESH_0];
@@ -3968,11 +4001,18 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
        * It might happen that there is a closer viscous wall in zone iZone for points in zone jZone. ---*/
         for (int jZone = 0; jZone < nZone; jZone++){
           if (wallDistanceNeeded[jZone])
-            geometry_container[jZone][iInst][MESH_0]->SetWallDistance(config_container[jZone], WallADT.get());
+            geometry_container[jZone][iInst][MESH_0]->SetWallDistance(config_container[jZone], WallADT.get(),
+                                                                      iZone, maxWallDisp);
         }
       }
     }
 
+    /*--- The references are kept in all zones, as their walls also displace. ---*/
+    if (allowIncremental) {
+      for (int iZone = 0; iZone < nZone; iZone++)
+        geometry_container[iZone][iInst][MESH_0]->UpdateWallDistanceReference(config_container[iZone], maxWallDisp);
+    }
+
     /*--- If there are no viscous walls in the entire domain, set distances to zero ---*/
     if (allEmpty){
       for (int iZone = 0; iZone < nZone; iZone++){
@@ -3980,6 +4020,26 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
         geometry->SetWallDistance(0.0);
       }
     }
+
+    /*--- The turbulence models solved with multigrid also need the distance on the coarse
+     * levels, it is restricted from the fine level (volume weighted, as the solution). ---*/
+    for (int iZone = 0; iZone < nZone; iZone++){
+      if (!wallDistanceNeeded[iZone] || !config_container[iZone]->GetMultigrid_Turb()) continue;
+
+      for (unsigned short iMesh = 1; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++){
+        const CGeometry *geo_fine = geometry_container[iZone][iInst][iMesh-1];
+        CGeometry *geo_coarse = geometry_container[iZone][iInst][iMesh];
+
+        for (unsigned long iPoint = 0; iPoint < geo_coarse->GetnPoint(); iPoint++){
+          su2double dist = 0.0;
+          for (unsigned short iChild = 0; iChild < geo_coarse->nodes->GetnChildren_CV(iPoint); iChild++){
+            const auto jPoint = geo_coarse->nodes->GetChildren_CV(iPoint, iChild);
+            dist += geo_fine->nodes->GetWall_Distance(jPoint) * geo_fine->nodes->GetVolume(jPoint);
+          }
+          geo_coarse->nodes->SetWall_Distance(iPoint, dist / geo_coarse->nodes->GetVolume(iPoint));
+        }
+      }
+    }
   }
 }
 
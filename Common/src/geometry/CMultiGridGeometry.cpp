@@ -28,6 +28,7 @@
 #include "../../include/geometry/CMultiGridGeometry.hpp"
 #include "../../include/CMultiGridQueue.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/omp_structure.hpp"
 
 
 CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh) : CGeometry() {
@@ -38,6 +39,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
   CGeometry *fine_grid = geometry[iMesh-1];
   CConfig *config = config_container;
 
+  const passivedouble StartTime = SU2_MPI::Wtime();
+
   /*--- Local variables ---*/
 
   unsigned long iPoint, Index_CoarseCV, iElem, iVertex, iteration, nVertexS, nVertexR,
@@ -86,6 +89,10 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   }
 
+  /*--- Strength of the coupling of the anisotropic points for the directional agglomeration ---*/
+
+  if (config->GetMG_QualityAgglomeration()) SetDirectionalCoupling(fine_grid, config);
+
   /*--- Create the coarse grid structure using as baseline the fine grid ---*/
 
   CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
@@ -108,6 +115,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
       if ((fine_grid->nodes->GetAgglomerate(iPoint) == false) &&
           (fine_grid->nodes->GetDomain(iPoint)) &&
+          (!InterfaceCheck(iPoint, fine_grid, config)) &&
           (GeometricalCheck(iPoint, fine_grid, config))) {
 
         nChildren = 1;
@@ -155,11 +163,14 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
           /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
 
-          for (auto CVPoint : fine_grid->nodes->GetPoints(iPoint)) {
+          for (iNode = 0; iNode < fine_grid->nodes->GetnPoint(iPoint); iNode++) {
+
+            const auto CVPoint = fine_grid->nodes->GetPoint(iPoint, iNode);
 
             /*--- The new point can be agglomerated ---*/
 
-            if (SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
+            if (DirectionalCheck(iPoint, iNode, fine_grid) &&
+                SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
 
               /*--- We set the value of the parent ---*/
 
@@ -175,7 +186,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
           Suitable_Indirect_Neighbors.clear();
 
-          if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+          if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint) && IsotropicCheck(iPoint))
             SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
 
           /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
@@ -184,7 +195,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
             /*--- The new point can be agglomerated ---*/
 
-            if (SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
+            if (IsotropicCheck(CVPoint) && SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
 
               /*--- We set the value of the parent ---*/
 
@@ -221,7 +232,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
     for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++) {
       iPoint = fine_grid->vertex[iMarker][iVertex]->GetNode();
       if ((fine_grid->nodes->GetAgglomerate(iPoint) == false) &&
-          (fine_grid->nodes->GetDomain(iPoint))) {
+          (fine_grid->nodes->GetDomain(iPoint)) &&
+          (!InterfaceCheck(iPoint, fine_grid, config))) {
         fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
         nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
         nodes->SetnChildren_CV(Index_CoarseCV, 1);
@@ -285,12 +297,15 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
       /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
 
-      for (auto CVPoint : fine_grid->nodes->GetPoints(iPoint)) {
+      for (iNode = 0; iNode < fine_grid->nodes->GetnPoint(iPoint); iNode++) {
+
+        const auto CVPoint = fine_grid->nodes->GetPoint(iPoint, iNode);
 
         /*--- Determine if the CVPoint can be agglomerated ---*/
 
         if ((fine_grid->nodes->GetAgglomerate(CVPoint) == false) &&
             (fine_grid->nodes->GetDomain(CVPoint)) &&
+            (DirectionalCheck(iPoint, iNode, fine_grid)) &&
             (GeometricalCheck(CVPoint, fine_grid, config))) {
 
           /*--- We set the value of the parent ---*/
@@ -314,7 +329,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
       /*--- Subrotuine to identify the indirect neighbors ---*/
 
       Suitable_Indirect_Neighbors.clear();
-      if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+      if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint) && IsotropicCheck(iPoint))
         SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
 
       /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
@@ -324,7 +339,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
         /*--- The new point can be agglomerated ---*/
 
         if ((fine_grid->nodes->GetAgglomerate(CVPoint) == false) &&
-            (fine_grid->nodes->GetDomain(CVPoint))) {
+            (fine_grid->nodes->GetDomain(CVPoint)) &&
+            (IsotropicCheck(CVPoint))) {
 
           /*--- We set the value of the parent ---*/
 
@@ -391,19 +407,25 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
     /*--- Temporary, CPoint (nodes) then compresses the information ---*/
     vector<vector<unsigned long> > points(fine_grid->GetnPoint());
 
-    for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
-      for (iChildren = 0; iChildren <  nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
-        iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
-        for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFinePoint)) {
-          iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
-          if (iParent != iCoarsePoint) {
-            auto End = points[iCoarsePoint].end();
-            if (find(points[iCoarsePoint].begin(), End, iParent) == End)
-              points[iCoarsePoint].push_back(iParent);
+    /*--- Each coarse point only modifies its own list. ---*/
+
+    SU2_OMP_PARALLEL
+    {
+    SU2_OMP_FOR_DYN(256)
+    for (auto iCoarse = 0ul; iCoarse < nPointDomain; iCoarse ++) {
+      for (auto iChild = 0u; iChild < nodes->GetnChildren_CV(iCoarse); iChild ++) {
+        const auto iFine = nodes->GetChildren_CV(iCoarse, iChild);
+        for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFine)) {
+          const auto iParentNeighbor = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
+          if (iParentNeighbor != iCoarse) {
+            auto End = points[iCoarse].end();
+            if (find(points[iCoarse].begin(), End, iParentNeighbor) == End)
+              points[iCoarse].push_back(iParentNeighbor);
           }
         }
       }
     }
+    }
     nodes->SetPoints(points);
   }
 
@@ -615,6 +637,15 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
   SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
   SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 
+  /*--- The directional coupling is not needed anymore. ---*/
+
+  vector<su2double>().swap(StrongCoupling);
+
+  /*--- Agglomeration time of the slowest rank. ---*/
+
+  passivedouble SetupTime = SU2_MPI::Wtime() - StartTime, MaxSetupTime = SetupTime;
+  SelectMPIWrapper<passivedouble>::W::Allreduce(&SetupTime, &MaxSetupTime, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
   su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
 
   if (iMesh != MESH_0) {
@@ -637,16 +668,17 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
       MGTable.AddColumn("CVs", 10);
       MGTable.AddColumn("Aggl. Rate", 10);
       MGTable.AddColumn("CFL", 10);
+      MGTable.AddColumn("Time (s)", 10);
       MGTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
 
 
       if (iMesh == 1){
         MGTable.PrintHeader();
-        MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh -1);
+        MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh -1) << "-";
       }
       stringstream ss;
       ss << "1/" << std::setprecision(3) << ratio;
-      MGTable << iMesh << Global_nPointCoarse << ss.str() << CFL;
+      MGTable << iMesh << Global_nPointCoarse << ss.str() << CFL << MaxSetupTime;
       if (iMesh == config->GetnMGLevels()){
         MGTable.PrintFooter();
       }
@@ -902,6 +934,83 @@ void CMultiGridGeometry::SetSuitableNeighbors(vector<unsigned long> *Suitable_In
 
 }
 
+su2double CMultiGridGeometry::CouplingWeight(unsigned long iPoint, unsigned short iNeigh, const CGeometry *fine_grid) const {
+
+  const auto jPoint = fine_grid->nodes->GetPoint(iPoint, iNeigh);
+  const auto iEdge = fine_grid->nodes->GetEdge(iPoint, iNeigh);
+
+  const su2double *Normal = fine_grid->edges->GetNormal(iEdge);
+  const su2double *Coord_i = fine_grid->nodes->GetCoord(iPoint);
+  const su2double *Coord_j = fine_grid->nodes->GetCoord(jPoint);
+
+  su2double Area2 = 0.0, Dist2 = 0.0;
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    Area2 += pow(Normal[iDim], 2);
+    Dist2 += pow(Coord_j[iDim]-Coord_i[iDim], 2);
+  }
+  return sqrt(Area2/Dist2);
+
+}
+
+void CMultiGridGeometry::SetDirectionalCoupling(const CGeometry *fine_grid, const CConfig *config) {
+
+  const su2double Ratio = config->GetMG_DirectionalRatio();
+  const unsigned long nPointFine = fine_grid->GetnPoint();
+
+  StrongCoupling.resize(nPointFine);
+
+  /*--- The points are independent, unlike the seeds of the agglomeration which are processed
+   in order (each seed depends on the previous ones). In stretched regions (e.g. boundary layers)
+   the coupling is much stronger in one direction (normal to the wall), only the neighbors in that
+   direction are agglomerated (semi-coarsening), which keeps the aspect ratio of the coarse CVs. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointFine, omp_get_num_threads()))
+  for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+
+    su2double MinWeight = numeric_limits<su2double>::max(), MaxWeight = 0.0;
+
+    for (unsigned short iNeigh = 0; iNeigh < fine_grid->nodes->GetnPoint(iPoint); iNeigh++) {
+      const su2double Weight = CouplingWeight(iPoint, iNeigh, fine_grid);
+      MinWeight = min(MinWeight, Weight);
+      MaxWeight = max(MaxWeight, Weight);
+    }
+
+    StrongCoupling[iPoint] = (MaxWeight > Ratio*MinWeight)? 0.5*MaxWeight : 0.0;
+  }
+  }
+
+}
+
+bool CMultiGridGeometry::DirectionalCheck(unsigned long iPoint, unsigned short iNeigh, const CGeometry *fine_grid) const {
+
+  if (StrongCoupling.empty()) return true;
+
+  /*--- The coupling must be strong from the point of view of both points. ---*/
+
+  const auto jPoint = fine_grid->nodes->GetPoint(iPoint, iNeigh);
+  const su2double Threshold = max(StrongCoupling[iPoint], StrongCoupling[jPoint]);
+
+  return (Threshold == 0.0) || (CouplingWeight(iPoint, iNeigh, fine_grid) >= Threshold);
+
+}
+
+bool CMultiGridGeometry::InterfaceCheck(unsigned long iPoint, const CGeometry *fine_grid, const CConfig *config) const {
+
+  if (!config->GetMG_QualityAgglomeration()) return false;
+
+  /*--- The partition interfaces are not physical boundaries, the points that are only on those can
+   be agglomerated with the interior points (instead of only along the interface). ---*/
+
+  for (unsigned short iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
+    if ((fine_grid->nodes->GetVertex(iPoint, iMarker) != -1) &&
+        (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE)) return false;
+  }
+  return true;
+
+}
+
 void CMultiGridGeometry::SetPoint_Connectivity(CGeometry *fine_grid) {
 
   unsigned long iFinePoint, iParent, iCoarsePoint;
@@ -1206,6 +1315,17 @@ void CMultiGridGeometry::SetCoord(CGeometry *geometry) {
   }
 }
 
+void CMultiGridGeometry::SetHaloControlVolume(const CConfig *config) {
+
+  if (!config->GetMG_QualityAgglomeration()) return;
+
+  InitiateComms(this, config, CONTROL_VOLUME);
+  CompleteComms(this, config, CONTROL_VOLUME);
+
+  InitiateComms(this, config, COORDINATES);
+  CompleteComms(this, config, COORDINATES);
+}
+
 void CMultiGridGeometry::SetMultiGridWallHeatFlux(CGeometry *geometry, unsigned short val_marker){
 
   unsigned long Point_Fine, Point_Coarse, iVertex;
@@ -1322,6 +1442,12 @@ void CMultiGridGeometry::SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfi
     for (unsigned short iDim = 0; iDim < nDim; iDim++)
       nodes->SetGridVel(Point_Coarse, iDim, Grid_Vel[iDim]);
   }
+
+  /*--- Halo CVs may only have part of the children of their owner. ---*/
+  if (config->GetMG_QualityAgglomeration()) {
+    InitiateComms(this, config, GRID_VELOCITY);
+    CompleteComms(this, config, GRID_VELOCITY);
+  }
 }
 
 
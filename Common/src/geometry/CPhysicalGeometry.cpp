@@ -11122,7 +11122,8 @@ std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CC
 
 }
 
-void CPhysicalGeometry::SetWallDistance(const CConfig *config, CADTElemClass *WallADT) {
+void CPhysicalGeometry::SetWallDistance(const CConfig *config, CADTElemClass *WallADT,
+                                        unsigned short iZoneADT, su2double maxWallDisp) {
 
   /*--------------------------------------------------------------------------*/
   /*--- Step 3: Loop over all interior mesh nodes and compute minimum      ---*/
@@ -11132,10 +11133,64 @@ void CPhysicalGeometry::SetWallDistance(const CConfig *config, CADTElemClass *Wa
   /*--- Store marker list and roughness in a global array. ---*/
   if (config->GetnRoughWall() > 0) SetGlobalMarkerRoughness(config);
 
+  /*--- In an incremental update the nearest wall element of the last full computation
+   * is known for each point. If the point and the walls moved little compared to the
+   * reference distance, the distance to that element is accurate enough and no search
+   * is needed, otherwise the element is used as initial guess for the search. ---*/
+  const bool incremental = (maxWallDisp >= 0.0);
+  const passivedouble tol = SU2_TYPE::GetValue(config->GetWallDistance_UpdateTol());
+  const passivedouble maxDisp = SU2_TYPE::GetValue(maxWallDisp);
+
+  if (WallADT->IsEmpty()) return;
+
+  if (!incremental) {
+    WallDistZone.resize(nPoint, iZoneADT);
+    WallDistElem.resize(nPoint, WallADT->GetnElem());
+  }
+
+  /*--- Lambda to store the result of a search if it is closer than the current wall. ---*/
+  auto UpdateDistance = [&](unsigned long iPoint, su2double dist, unsigned long iElemADT,
+                            unsigned short markerID, int rankID) {
+
+    if (dist >= nodes->GetWall_Distance(iPoint)) return;
+
+    nodes->SetWall_Distance(iPoint, dist);
+    WallDistZone[iPoint] = iZoneADT;
+    WallDistElem[iPoint] = iElemADT;
+
+    if (config->GetnRoughWall() > 0) {
+      auto index = GlobalMarkerStorageDispl[rankID] + markerID;
+      auto localRoughness = GlobalRoughness_Height[index];
+      nodes->SetRoughnessHeight(iPoint, localRoughness);
+    }
+  };
+
+  if (!incremental) {
+    /*--- Solid wall boundary nodes are present. Compute the wall distance for all
+     nodes with the batched search of the ADT, the nearest element from a previous
+     computation (if any) is the initial guess. ---*/
+
+    vector<unsigned long> iElemADT(nPoint);
+    vector<su2double> dist;
+    vector<unsigned short> markerID;
+    vector<unsigned long> elemID;
+    vector<int> rankID;
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+      iElemADT[iPoint] = (WallDistZone[iPoint] == iZoneADT)? WallDistElem[iPoint] : WallADT->GetnElem();
+
+    WallADT->DetermineNearestElements(nodes->GetCoord(), iElemADT, dist, markerID, elemID, rankID);
+
+    SU2_OMP_PARALLEL_(for schedule(static,roundUpDiv(nPoint,omp_get_max_threads())))
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+      UpdateDistance(iPoint, dist[iPoint], iElemADT[iPoint], markerID[iPoint], rankID[iPoint]);
+
+    return;
+  }
+
   SU2_OMP_PARALLEL
-  if (!WallADT->IsEmpty()) {
-    /*--- Solid wall boundary nodes are present. Compute the wall
-     distance for all nodes. ---*/
+  {
+    unsigned long nQueries = 0;
 
     SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
     for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
@@ -11144,21 +11199,90 @@ void CPhysicalGeometry::SetWallDistance(const CConfig *config, CADTElemClass *Wa
       int            rankID;
       su2double      dist;
 
-      WallADT->DetermineNearestElement(nodes->GetCoord(iPoint), dist, markerID, elemID, rankID);
+      const auto coord = nodes->GetCoord(iPoint);
+      const bool ownZone = (WallDistZone[iPoint] == iZoneADT);
+      unsigned long iElemADT = ownZone? WallDistElem[iPoint] : WallADT->GetnElem();
+
+      /*--- Bound for the change of the distance, due to the motion of the point and of the walls. ---*/
+      passivedouble pointDisp = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        pointDisp += pow(SU2_TYPE::GetValue(coord[iDim]) - WallDistRefCoord(iPoint,iDim), 2);
+      pointDisp = sqrt(pointDisp);
 
-      nodes->SetWall_Distance(iPoint, min(dist,nodes->GetWall_Distance(iPoint)));
+      const bool accept = (2.0*(pointDisp + maxDisp) <= tol*WallDistRefValue[iPoint]);
 
-      if (config->GetnRoughWall() > 0) {
-        auto index = GlobalMarkerStorageDispl[rankID] + markerID;
-        auto localRoughness = GlobalRoughness_Height[index];
-        nodes->SetRoughnessHeight(iPoint, localRoughness);
+      if (accept) {
+        /*--- The nearest wall element is in another zone, nothing to do. ---*/
+        if (!ownZone) continue;
+        WallADT->DistanceToElement(coord, iElemADT, dist, markerID, elemID, rankID);
       }
+      else {
+        WallADT->DetermineNearestElement(coord, iElemADT, dist, markerID, elemID, rankID);
+        /*--- Halos are counted by their owners, the total is compared with nPointDomain. ---*/
+        nQueries += ownZone && (iPoint < nPointDomain);
+      }
+
+      UpdateDistance(iPoint, dist, iElemADT, markerID, rankID);
     }
 
+    SU2_OMP_ATOMIC
+    nWallDistQueries += nQueries;
   }
   // end SU2_OMP_PARALLEL
 }
 
+bool CPhysicalGeometry::GetMaxWallDisplacement(const CConfig *config, su2double &maxWallDisp) const {
+
+  if (WallDistRefCoord.rows() != nPoint) return false;
+
+  /*--- Largest displacement of the viscous walls since the last full computation. ---*/
+  passivedouble maxDisp = 0.0;
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); ++iMarker) {
+    if (!config->GetViscous_Wall(iMarker)) continue;
+
+    for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; ++iVertex) {
+      const auto iPoint = vertex[iMarker][iVertex]->GetNode();
+      passivedouble disp = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        disp += pow(SU2_TYPE::GetValue(nodes->GetCoord(iPoint,iDim)) - WallDistRefCoord(iPoint,iDim), 2);
+      maxDisp = max(maxDisp, disp);
+    }
+  }
+  maxWallDisp = sqrt(maxDisp);
+
+  return true;
+}
+
+void CPhysicalGeometry::UpdateWallDistanceReference(const CConfig *config, su2double maxWallDisp) {
+
+  const bool incremental = (maxWallDisp >= 0.0);
+
+  if (incremental) {
+    /*--- If the references are outdated for a large fraction of the points, the next
+     * update is a full computation, which resets them. Otherwise the references of the
+     * last full computation are kept, such that the bounds used above remain valid. ---*/
+    unsigned long nLocal[] = {nWallDistQueries, nPointDomain}, nGlobal[] = {0, 0};
+    SU2_MPI::Allreduce(nLocal, nGlobal, 2, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+    nWallDistQueries = 0;
+    if (2*nGlobal[0] > nGlobal[1]) WallDistRefCoord.resize(0,0);
+    return;
+  }
+
+  /*--- Store the coordinates and distances of the full computation. ---*/
+  WallDistRefCoord.resize(nPoint, nDim);
+  WallDistRefValue.resize(nPoint);
+
+  SU2_OMP_PARALLEL_(for schedule(static,roundUpDiv(nPoint,omp_get_max_threads())))
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      WallDistRefCoord(iPoint,iDim) = SU2_TYPE::GetValue(nodes->GetCoord(iPoint,iDim));
+    WallDistRefValue[iPoint] = SU2_TYPE::GetValue(nodes->GetWall_Distance(iPoint));
+  }
+  nWallDistQueries = 0;
+}
+
 void CPhysicalGeometry::SetGlobalMarkerRoughness(const CConfig* config) {
 
   const auto nMarker_All = config->GetnMarker_All();
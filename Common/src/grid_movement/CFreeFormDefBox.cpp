@@ -968,6 +968,268 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
 
 }
 
+void CFreeFormDefBox::SetBlendingPolynomials() {
+
+  const unsigned short nBasis[3] = {lOrder, mOrder, nOrder};
+
+  for (unsigned short iDir = 0; iDir < 3; iDir++) {
+
+    /*--- Both Bezier (single span) and uniform B-Splines are piecewise polynomials
+     of degree p on nBasis-p uniform spans of [0,1]. ---*/
+
+    const unsigned short p = SU2_TYPE::Int(BlendingFunction[iDir]->GetDegree());
+    const unsigned short nCoeff = p+1;
+    const unsigned short nSpan = max(nBasis[iDir]-p, 1);
+
+    BasisSize[iDir] = nBasis[iDir];
+    BasisDegree[iDir] = p;
+    BasisSpans[iDir] = nSpan;
+    BasisCoeff[iDir].assign(nSpan*nBasis[iDir]*nCoeff, 0.0);
+
+    /*--- The pieces are recovered by interpolation at p+1 points inside each span (avoiding
+     the knots where the evaluation is one-sided), the local variable is x in [0,1]. The
+     Vandermonde matrix is the same for all spans, it is inverted once (Gauss-Jordan). ---*/
+
+    vector<su2double> Vinv(nCoeff*nCoeff, 0.0), V(nCoeff*nCoeff), x(nCoeff);
+    for (unsigned short j = 0; j < nCoeff; j++) {
+      x[j] = (j+0.5)/nCoeff;
+      su2double xk = 1.0;
+      for (unsigned short k = 0; k < nCoeff; k++) { V[j*nCoeff+k] = xk; xk *= x[j]; }
+      Vinv[j*nCoeff+j] = 1.0;
+    }
+    for (unsigned short k = 0; k < nCoeff; k++) {
+      unsigned short piv = k;
+      for (unsigned short j = k+1; j < nCoeff; j++)
+        if (fabs(V[j*nCoeff+k]) > fabs(V[piv*nCoeff+k])) piv = j;
+      for (unsigned short l = 0; l < nCoeff; l++) {
+        swap(V[k*nCoeff+l], V[piv*nCoeff+l]);
+        swap(Vinv[k*nCoeff+l], Vinv[piv*nCoeff+l]);
+      }
+      const su2double diag = V[k*nCoeff+k];
+      for (unsigned short l = 0; l < nCoeff; l++) { V[k*nCoeff+l] /= diag; Vinv[k*nCoeff+l] /= diag; }
+      for (unsigned short j = 0; j < nCoeff; j++) {
+        if (j == k) continue;
+        const su2double factor = V[j*nCoeff+k];
+        for (unsigned short l = 0; l < nCoeff; l++) {
+          V[j*nCoeff+l] -= factor*V[k*nCoeff+l];
+          Vinv[j*nCoeff+l] -= factor*Vinv[k*nCoeff+l];
+        }
+      }
+    }
+
+    vector<su2double> values(nCoeff);
+    for (unsigned short iSpan = 0; iSpan < nSpan; iSpan++) {
+      for (unsigned short iBasis = 0; iBasis < nBasis[iDir]; iBasis++) {
+        for (unsigned short j = 0; j < nCoeff; j++)
+          values[j] = BlendingFunction[iDir]->GetBasis(iBasis, (iSpan+x[j])/nSpan);
+
+        su2double* coeff = &BasisCoeff[iDir][(iSpan*nBasis[iDir]+iBasis)*nCoeff];
+        for (unsigned short k = 0; k < nCoeff; k++)
+          for (unsigned short j = 0; j < nCoeff; j++)
+            coeff[k] += Vinv[k*nCoeff+j]*values[j];
+      }
+    }
+  }
+}
+
+void CFreeFormDefBox::EvalCartesianCoord_Poly(const su2double *uvw, su2double *xyz, su2double jac[][3], su2double *work) const {
+
+  /*--- Values and derivatives of the blending functions in each direction, out of range
+   parametric coordinates use the polynomial of the first/last span (smooth extension). ---*/
+
+  su2double *N[3], *dN[3];
+  N[0] = work; N[1] = N[0]+BasisSize[0]; N[2] = N[1]+BasisSize[1];
+  dN[0] = N[2]+BasisSize[2]; dN[1] = dN[0]+BasisSize[0]; dN[2] = dN[1]+BasisSize[1];
+
+  for (unsigned short iDir = 0; iDir < 3; iDir++) {
+    const auto nSpan = BasisSpans[iDir];
+    const auto p = BasisDegree[iDir];
+    const su2double scaled = uvw[iDir]*nSpan;
+    const int iSpan = max(0, min(int(nSpan)-1, SU2_TYPE::Int(floor(scaled))));
+    const su2double x = scaled - iSpan;
+
+    for (unsigned short iBasis = 0; iBasis < BasisSize[iDir]; iBasis++) {
+      const su2double* coeff = &BasisCoeff[iDir][(iSpan*BasisSize[iDir]+iBasis)*(p+1)];
+      su2double val = coeff[p], der = 0.0;
+      for (int k = int(p)-1; k >= 0; k--) {
+        der = der*x + val;
+        val = val*x + coeff[k];
+      }
+      N[iDir][iBasis] = val;
+      dN[iDir][iBasis] = der*nSpan;
+    }
+  }
+
+  for (unsigned short iDim = 0; iDim < 3; iDim++) {
+    xyz[iDim] = 0.0;
+    for (unsigned short jDir = 0; jDir < 3; jDir++) jac[iDim][jDir] = 0.0;
+  }
+
+  for (unsigned short iDegree = 0; iDegree <= lDegree; iDegree++) {
+    for (unsigned short jDegree = 0; jDegree <= mDegree; jDegree++) {
+      const su2double Nij = N[0][iDegree]*N[1][jDegree];
+      const su2double dNij_u = dN[0][iDegree]*N[1][jDegree];
+      const su2double dNij_v = N[0][iDegree]*dN[1][jDegree];
+      for (unsigned short kDegree = 0; kDegree <= nDegree; kDegree++) {
+        const su2double* CP = Coord_Control_Points[iDegree][jDegree][kDegree];
+        const su2double w = Nij*N[2][kDegree];
+        const su2double w_u = dNij_u*N[2][kDegree];
+        const su2double w_v = dNij_v*N[2][kDegree];
+        const su2double w_w = Nij*dN[2][kDegree];
+        for (unsigned short iDim = 0; iDim < 3; iDim++) {
+          xyz[iDim] += w*CP[iDim];
+          jac[iDim][0] += w_u*CP[iDim];
+          jac[iDim][1] += w_v*CP[iDim];
+          jac[iDim][2] += w_w*CP[iDim];
+        }
+      }
+    }
+  }
+}
+
+unsigned long CFreeFormDefBox::GetParametricCoord_Batch(const su2activematrix& xyz, su2activematrix& uvw, vector<char>& converged,
+                                                        bool useGuess, const CConfig *config) {
+
+  const unsigned long nPoint = xyz.rows();
+  const su2double tol = config->GetFFD_Tol()*1E-3;
+  const unsigned short it_max = config->GetnFFD_Iter();
+  const unsigned short workSize = 2*(lOrder+mOrder+nOrder);
+
+  converged.assign(nPoint, false);
+  if (!useGuess) uvw.resize(nPoint, 3);
+
+  SetBlendingPolynomials();
+
+  /*--- Coarse lattice of the box in parametric space to provide the initial guesses. ---*/
+
+  const unsigned short nLattice = max(4, min(9, max(max(lOrder, mOrder), nOrder)+1));
+  const unsigned long nLatticePoint = nLattice*nLattice*nLattice;
+  su2activematrix LatticeXYZ(nLatticePoint, 3), LatticeUVW(nLatticePoint, 3);
+  {
+    vector<su2double> work(workSize);
+    su2double jac[3][3];
+    unsigned long iLattice = 0;
+    for (unsigned short i = 0; i < nLattice; i++)
+      for (unsigned short j = 0; j < nLattice; j++)
+        for (unsigned short k = 0; k < nLattice; k++, iLattice++) {
+          LatticeUVW(iLattice,0) = su2double(i)/(nLattice-1);
+          LatticeUVW(iLattice,1) = su2double(j)/(nLattice-1);
+          LatticeUVW(iLattice,2) = su2double(k)/(nLattice-1);
+          EvalCartesianCoord_Poly(LatticeUVW[iLattice], LatticeXYZ[iLattice], jac, work.data());
+        }
+  }
+
+  /*--- Tolerance for the (squared) distance to the target, relative to the size of the box. ---*/
+
+  su2double boxSize = 0.0;
+  for (unsigned short iDim = 0; iDim < 3; iDim++) {
+    su2double minCoord = LatticeXYZ(0,iDim), maxCoord = LatticeXYZ(0,iDim);
+    for (unsigned long iLattice = 1; iLattice < nLatticePoint; iLattice++) {
+      minCoord = min(minCoord, LatticeXYZ(iLattice,iDim));
+      maxCoord = max(maxCoord, LatticeXYZ(iLattice,iDim));
+    }
+    boxSize = max(boxSize, maxCoord-minCoord);
+  }
+  const su2double tolNorm = pow(tol*boxSize, 2);
+
+  unsigned long nFailed = 0;
+
+  SU2_OMP_PARALLEL
+  {
+  vector<su2double> work(workSize);
+  su2double X[3], jac[3][3], F[3], step[3], trial[3];
+  unsigned long myFailed = 0;
+
+  auto Residual = [&](const su2double* param, const su2double* target) {
+    EvalCartesianCoord_Poly(param, X, jac, work.data());
+    su2double norm = 0.0;
+    for (unsigned short iDim = 0; iDim < 3; iDim++) {
+      F[iDim] = X[iDim] - target[iDim];
+      norm += F[iDim]*F[iDim];
+    }
+    return norm;
+  };
+
+  SU2_OMP_FOR_DYN(64)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+
+    const su2double* target = xyz[iPoint];
+    su2double* param = uvw[iPoint];
+
+    /*--- Initial guess, the closest lattice point unless the given guess is closer. ---*/
+
+    su2double minDist = numeric_limits<passivedouble>::max();
+    unsigned long closest = 0;
+    for (unsigned long iLattice = 0; iLattice < nLatticePoint; iLattice++) {
+      su2double dist = 0.0;
+      for (unsigned short iDim = 0; iDim < 3; iDim++)
+        dist += pow(LatticeXYZ(iLattice,iDim) - target[iDim], 2);
+      if (dist < minDist) { minDist = dist; closest = iLattice; }
+    }
+
+    su2double norm = useGuess? Residual(param, target) : minDist;
+    if (!useGuess || (minDist < norm)) {
+      for (unsigned short iDir = 0; iDir < 3; iDir++) param[iDir] = LatticeUVW(closest,iDir);
+    }
+    norm = Residual(param, target);
+
+    /*--- Newton iterations on xyz(uvw) - target = 0 with backtracking. ---*/
+
+    for (unsigned short iter = 0; iter < it_max; iter++) {
+
+      /*--- Solve jac * step = -F by Cramer's rule. ---*/
+
+      const su2double det = jac[0][0]*(jac[1][1]*jac[2][2]-jac[1][2]*jac[2][1])
+                          - jac[0][1]*(jac[1][0]*jac[2][2]-jac[1][2]*jac[2][0])
+                          + jac[0][2]*(jac[1][0]*jac[2][1]-jac[1][1]*jac[2][0]);
+      if (fabs(det) < EPS*EPS) break;
+
+      for (unsigned short iDir = 0; iDir < 3; iDir++) {
+        su2double A[3][3];
+        for (unsigned short iDim = 0; iDim < 3; iDim++)
+          for (unsigned short jDir = 0; jDir < 3; jDir++)
+            A[iDim][jDir] = (jDir == iDir)? -F[iDim] : jac[iDim][jDir];
+        step[iDir] = (A[0][0]*(A[1][1]*A[2][2]-A[1][2]*A[2][1])
+                    - A[0][1]*(A[1][0]*A[2][2]-A[1][2]*A[2][0])
+                    + A[0][2]*(A[1][0]*A[2][1]-A[1][1]*A[2][0])) / det;
+      }
+
+      /*--- A small step only means convergence if the distance is also small (the Jacobian
+       *    may be nearly singular), otherwise the serial inversion is left to handle the point. ---*/
+
+      const su2double maxStep = max(fabs(step[0]), max(fabs(step[1]), fabs(step[2])));
+      if (maxStep < tol) { converged[iPoint] = (norm < tolNorm); break; }
+
+      /*--- Backtracking, the step is halved until the distance decreases. ---*/
+
+      su2double relax = 1.0;
+      bool decrease = false;
+      for (unsigned short iTrial = 0; iTrial < 10; iTrial++, relax *= 0.5) {
+        for (unsigned short iDir = 0; iDir < 3; iDir++) trial[iDir] = param[iDir] + relax*step[iDir];
+        const su2double trialNorm = Residual(trial, target);
+        if (trialNorm < norm) { norm = trialNorm; decrease = true; break; }
+      }
+
+      /*--- No decrease along the Newton direction, param is kept and the point is not converged. ---*/
+      if (!decrease) break;
+
+      /*--- X, F, and jac were evaluated at the accepted trial. ---*/
+      for (unsigned short iDir = 0; iDir < 3; iDir++) param[iDir] = trial[iDir];
+
+      if ((relax*maxStep < tol) && (norm < tolNorm)) { converged[iPoint] = true; break; }
+    }
+
+    if (!converged[iPoint]) myFailed++;
+  }
+
+  SU2_OMP_ATOMIC
+  nFailed += myFailed;
+
+  } // end SU2_OMP_PARALLEL
+
+  return nFailed;
+}
+
 bool CFreeFormDefBox::GetPointFFD(CGeometry *geometry, CConfig *config, unsigned long iPoint) const {
   su2double Coord[3] = {0.0, 0.0, 0.0};
   unsigned short iVar, jVar, iDim;
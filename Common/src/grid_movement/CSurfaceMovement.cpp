@@ -679,6 +679,15 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
         TotalVertex++;
 
+  /*--- Gather the (transformed) coordinates of the points inside the FFD. ---*/
+
+  vector<unsigned short> CandidateMarker;
+  vector<unsigned long> CandidateVertex;
+  vector<su2double> CandidateXYZ;
+  CandidateMarker.reserve(TotalVertex);
+  CandidateVertex.reserve(TotalVertex);
+  CandidateXYZ.reserve(3*TotalVertex);
+
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
     if (config->GetMarker_All_DV(iMarker) == YES) {
@@ -713,74 +722,96 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
 
         iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-        /*--- If the point is inside the FFD, compute the value of the parametric coordinate ---*/
+        /*--- If the point is inside the FFD, it is a candidate for the inversion ---*/
 
         if (FFDBox->GetPointFFD(geometry, config, iPoint)) {
+          CandidateXYZ.insert(CandidateXYZ.end(), CartCoord, CartCoord+3);
+          CandidateMarker.push_back(iMarker);
+          CandidateVertex.push_back(iVertex);
+        }
+      }
+    }
+  }
 
-          /*--- Find the parametric coordinate ---*/
+  /*--- Find the parametric coordinates of all candidates at once (threaded Newton
+   iterations), the few points that fail fall back to the serial algorithm. ---*/
 
-          ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+  const unsigned long nCandidate = CandidateVertex.size();
+  su2activematrix CandidateCoord(nCandidate, 3), CandidateParam;
+  for (unsigned long iCand = 0; iCand < nCandidate; iCand++)
+    for (iDim = 0; iDim < 3; iDim++) CandidateCoord(iCand, iDim) = CandidateXYZ[3*iCand+iDim];
+  vector<char> Converged;
 
-          /*--- Compute the cartesian coordinates using the parametric coordinates
-           to check that everything is correct ---*/
+  FFDBox->GetParametricCoord_Batch(CandidateCoord, CandidateParam, Converged, false, config);
 
-          CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+  for (unsigned long iCand = 0; iCand < nCandidate; iCand++) {
 
-          /*--- Compute max difference between original value and the recomputed value ---*/
+    iMarker = CandidateMarker[iCand];
+    iVertex = CandidateVertex[iCand];
+    iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (iDim = 0; iDim < 3; iDim++) CartCoord[iDim] = CandidateCoord(iCand, iDim);
 
-          Diff = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            Diff += (CartCoordNew[iDim]-CartCoord[iDim])*(CartCoordNew[iDim]-CartCoord[iDim]);
-          Diff = sqrt(Diff);
-          my_MaxDiff = max(my_MaxDiff, Diff);
+    /*--- Find the parametric coordinate ---*/
 
-          /*--- If the parametric coordinates are in (0,1) the point belongs to the FFDBox, using the input tolerance  ---*/
+    if (Converged[iCand]) ParamCoord = CandidateParam[iCand];
+    else ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
 
-          if (((ParamCoord[0] >= - config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[1] >= - config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[2] >= - config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
+    /*--- Compute the cartesian coordinates using the parametric coordinates
+     to check that everything is correct ---*/
 
+    CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
 
-            /*--- Rectification of the initial tolerance (we have detected situations
-             where 0.0 and 1.0 doesn't work properly ---*/
+    /*--- Compute max difference between original value and the recomputed value ---*/
 
-            su2double lower_limit = config->GetFFD_Tol();
-            su2double upper_limit = 1.0-config->GetFFD_Tol();
+    Diff = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Diff += (CartCoordNew[iDim]-CartCoord[iDim])*(CartCoordNew[iDim]-CartCoord[iDim]);
+    Diff = sqrt(Diff);
+    my_MaxDiff = max(my_MaxDiff, Diff);
 
-            if (ParamCoord[0] < lower_limit) ParamCoord[0] = lower_limit;
-            if (ParamCoord[1] < lower_limit) ParamCoord[1] = lower_limit;
-            if (ParamCoord[2] < lower_limit) ParamCoord[2] = lower_limit;
-            if (ParamCoord[0] > upper_limit) ParamCoord[0] = upper_limit;
-            if (ParamCoord[1] > upper_limit) ParamCoord[1] = upper_limit;
-            if (ParamCoord[2] > upper_limit) ParamCoord[2] = upper_limit;
+    /*--- If the parametric coordinates are in (0,1) the point belongs to the FFDBox, using the input tolerance  ---*/
 
-            /*--- Set the value of the parametric coordinate ---*/
+    if (((ParamCoord[0] >= - config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[1] >= - config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[2] >= - config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
 
-            FFDBox->Set_MarkerIndex(iMarker);
-            FFDBox->Set_VertexIndex(iVertex);
-            FFDBox->Set_PointIndex(iPoint);
-            FFDBox->Set_ParametricCoord(ParamCoord);
-            FFDBox->Set_CartesianCoord(CartCoord);
 
-            ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
+      /*--- Rectification of the initial tolerance (we have detected situations
+       where 0.0 and 1.0 doesn't work properly ---*/
 
-            if (Diff >= config->GetFFD_Tol()) {
-              cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
-              << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
-            }
+      su2double lower_limit = config->GetFFD_Tol();
+      su2double upper_limit = 1.0-config->GetFFD_Tol();
 
-          }
-          else {
+      if (ParamCoord[0] < lower_limit) ParamCoord[0] = lower_limit;
+      if (ParamCoord[1] < lower_limit) ParamCoord[1] = lower_limit;
+      if (ParamCoord[2] < lower_limit) ParamCoord[2] = lower_limit;
+      if (ParamCoord[0] > upper_limit) ParamCoord[0] = upper_limit;
+      if (ParamCoord[1] > upper_limit) ParamCoord[1] = upper_limit;
+      if (ParamCoord[2] > upper_limit) ParamCoord[2] = upper_limit;
 
-            if (Diff >= config->GetFFD_Tol()) {
-              cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
-              << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
-            }
+      /*--- Set the value of the parametric coordinate ---*/
 
-          }
+      FFDBox->Set_MarkerIndex(iMarker);
+      FFDBox->Set_VertexIndex(iVertex);
+      FFDBox->Set_PointIndex(iPoint);
+      FFDBox->Set_ParametricCoord(ParamCoord);
+      FFDBox->Set_CartesianCoord(CartCoord);
 
-        }
+      ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
+
+      if (Diff >= config->GetFFD_Tol()) {
+        cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
+        << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
+      }
+
+    }
+    else {
+
+      if (Diff >= config->GetFFD_Tol()) {
+        cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
+        << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
       }
+
     }
   }
 
@@ -1276,42 +1307,57 @@ void CSurfaceMovement::UpdateParametricCoord(CGeometry *geometry, CConfig *confi
   unsigned short iMarker, iDim;
   unsigned long iVertex, iPoint, iSurfacePoints;
   su2double CartCoord[3] = {0.0,0.0,0.0}, *CartCoordNew, *CartCoordOld;
-  su2double *ParamCoord, *var_coord, ParamCoordGuess[3] = {0.0,0.0,0.0};
+  su2double *ParamCoord, *var_coord;
   su2double MaxDiff, my_MaxDiff = 0.0, Diff;
 
-  /*--- Recompute the parametric coordinates ---*/
+  const unsigned long nSurfacePoints = FFDBox->GetnSurfacePoint();
 
-  for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
+  /*--- Compute and set the cartesian coord using the variation computed with the
+   previous deformation, the previous parametric coordinates are the initial guesses. ---*/
 
-    /*--- Get the marker of the surface point ---*/
+  su2activematrix SurfaceCoord(nSurfacePoints, 3), SurfaceParam(nSurfacePoints, 3);
+  vector<char> Converged;
+
+  for (iSurfacePoints = 0; iSurfacePoints < nSurfacePoints; iSurfacePoints++) {
 
     iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+    iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
+    iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
+
+    ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
+    for (iDim = 0; iDim < 3; iDim++) SurfaceParam(iSurfacePoints, iDim) = ParamCoord[iDim];
 
     if (config->GetMarker_All_DV(iMarker) == YES) {
+      var_coord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+      CartCoordOld = geometry->nodes->GetCoord(iPoint);
+      for (iDim = 0; iDim < 3; iDim++)
+        CartCoord[iDim] = CartCoordOld[iDim] + var_coord[iDim];
+      FFDBox->Set_CartesianCoord(CartCoord, iSurfacePoints);
+    }
+    for (iDim = 0; iDim < 3; iDim++)
+      SurfaceCoord(iSurfacePoints, iDim) = FFDBox->Get_CartesianCoord(iSurfacePoints)[iDim];
+  }
 
-      /*--- Get the vertex of the surface point ---*/
+  /*--- Recompute the parametric coordinates ---*/
 
-      iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
-      iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
+  FFDBox->GetParametricCoord_Batch(SurfaceCoord, SurfaceParam, Converged, true, config);
 
-      /*--- Get the parametric and cartesians coordinates of the
-       surface point (they don't mach) ---*/
+  for (iSurfacePoints = 0; iSurfacePoints < nSurfacePoints; iSurfacePoints++) {
 
-      ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
+    /*--- Get the marker of the surface point ---*/
 
-      /*--- Compute and set the cartesian coord using the variation computed
-       with the previous deformation ---*/
+    iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
 
-      var_coord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-      CartCoordOld = geometry->nodes->GetCoord(iPoint);
-      for (iDim = 0; iDim < 3; iDim++)
-        CartCoord[iDim] = CartCoordOld[iDim] + var_coord[iDim];
-      FFDBox->Set_CartesianCoord(CartCoord, iSurfacePoints);
+    if (config->GetMarker_All_DV(iMarker) == YES) {
 
-      /*--- Find the parametric coordinate using as ParamCoordGuess the previous value ---*/
+      iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
+      for (iDim = 0; iDim < 3; iDim++) CartCoord[iDim] = SurfaceCoord(iSurfacePoints, iDim);
 
-      ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
-      ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+      /*--- Points for which Newton failed use the serial algorithm from the previous value ---*/
+
+      ParamCoord = SurfaceParam[iSurfacePoints];
+      if (!Converged[iSurfacePoints])
+        ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, FFDBox->Get_ParametricCoord(iSurfacePoints), config);
 
       /*--- Set the new value of the parametric coordinates ---*/
 
@@ -52,11 +52,60 @@ CVolumetricMovement::CVolumetricMovement(CGeometry *geometry, CConfig *config) :
   if (config->GetVolumetric_Movement()){
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-    StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+
+    /*--- The stiffness matrix is not needed by the inverse distance weighting. ---*/
+    if (config->GetDeform_Method() == ELASTICITY_DEFORM) {
+      StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+
+      HybridParallelInitialization(geometry);
+    }
+  }
+}
+
+CVolumetricMovement::~CVolumetricMovement(void) {
+
+  if (LockStrategy) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      omp_destroy_lock(&UpdateLocks[iPoint]);
   }
 }
 
-CVolumetricMovement::~CVolumetricMovement(void) { }
+void CVolumetricMovement::HybridParallelInitialization(CGeometry* geometry) {
+#ifdef HAVE_OMP
+  /*--- Get the element coloring. ---*/
+
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetElementColoring(&parallelEff);
+
+  /*--- If the coloring is too bad use lock-guarded accesses
+   *    to CSysMatrix in element loops instead. ---*/
+  LockStrategy = parallelEff < COLORING_EFF_THRESH;
+
+  /*--- When using locks force a single color to reduce the color loop overhead. ---*/
+  if (LockStrategy && (coloring.getOuterSize()>1))
+    geometry->SetNaturalElementColoring();
+
+  if (!coloring.empty()) {
+    /*--- We are not constrained by the color group size when using locks. ---*/
+    auto groupSize = LockStrategy? 1ul : geometry->GetElementColorGroupSize();
+    auto nColor = coloring.getOuterSize();
+    ElemColoring.reserve(nColor);
+
+    for(auto iColor = 0ul; iColor < nColor; ++iColor)
+      ElemColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  }
+
+  if (LockStrategy) {
+    UpdateLocks.resize(nPoint);
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      omp_init_lock(&UpdateLocks[iPoint]);
+  }
+
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+#else
+  ElemColoring[0] = DummyGridColor<>(geometry->GetnElem());
+#endif
+}
 
 void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config) {
 
@@ -108,6 +157,7 @@ void CVolumetricMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config)
     geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
     geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine],UPDATE);
     geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    geometry[iMGlevel]->SetHaloControlVolume(config);
     if (config->GetGrid_Movement())
       geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine], config);
   }
@@ -116,6 +166,11 @@ void CVolumetricMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config)
 
 void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo, bool Derivative) {
 
+  if (config->GetDeform_Method() == IDW_DEFORM) {
+    SetVolume_Deformation_IDW(geometry, config, UpdateGeo, Derivative);
+    return;
+  }
+
   unsigned long Tot_Iter = 0;
   su2double MinVolume, MaxVolume;
 
@@ -132,6 +187,17 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
   if (Derivative) Nonlinear_Iter = 1;
 
+  /*--- The element stiffness changes little between increments (and between consecutive
+   deformations), so the factorization held by the stiffness matrix may be used to precondition
+   the new system until the linear solver takes too many iterations. Not for derivatives, as
+   the transposed system is factorized in that case. ---*/
+
+  const auto Reuse_Iter = config->GetDeform_Linear_Solver_Prec_Reuse();
+  const auto Kind_Prec = config->GetKind_Deform_Linear_Solver_Prec();
+  const bool Reuse_Prec = (Reuse_Iter > 0) && !Derivative && !config->GetDiscrete_Adjoint() &&
+                          ((Kind_Prec == ILU) || (Kind_Prec == JACOBI));
+  if (!Reuse_Prec) PrecondReady = false;
+
   /*--- Loop over the total number of grid deformation iterations. The surface
    deformation can be divided into increments to help with stability. In
    particular, the linear elasticity equations hold only for small deformations. ---*/
@@ -142,11 +208,11 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
     LinSysSol.SetValZero();
     LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
 
     /*--- Compute the stiffness matrix entries for all nodes/elements in the
      mesh. FEA uses a finite element method discretization of the linear
-     elasticity equations (transfers element stiffnesses to point-to-point). ---*/
+     elasticity equations (transfers element stiffnesses to point-to-point).
+     The matrix is cleared inside, by all threads. ---*/
 
     MinVolume = SetFEAMethodContributions_Elem(geometry, config);
 
@@ -179,14 +245,28 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     /*--- If we want no derivatives or the direct derivatives, we solve the system using the
      * normal matrix vector product and preconditioner. For the mesh sensitivities using
      * the discrete adjoint method we solve the system using the transposed matrix. ---*/
+    System.SetReusePreconditioner(PrecondReady);
+
+    SU2_OMP_PARALLEL
+    {
+    unsigned long iter = 0;
+
     if (!Derivative || ((config->GetKind_SU2() == SU2_CFD) && Derivative)) {
 
-      Tot_Iter = System.Solve(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
+      iter = System.Solve(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
 
-      Tot_Iter = System.Solve_b(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
+      iter = System.Solve_b(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
     }
+    SU2_OMP_MASTER
+    Tot_Iter = iter;
+    } // end SU2_OMP_PARALLEL
+
+    /*--- Refresh the preconditioner on the next solve if this one became too expensive. ---*/
+
+    PrecondReady = Reuse_Prec && (Tot_Iter <= Reuse_Iter);
+
     su2double Residual = System.GetResidual();
 
     /*--- Update the grid coordinates and cell volumes using the solution
@@ -215,6 +295,266 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
 }
 
+void CVolumetricMovement::SetVolume_Deformation_IDW(CGeometry *geometry, CConfig *config, bool UpdateGeo, bool Derivative) {
+
+  const auto Kind_SU2 = config->GetKind_SU2();
+  const auto nMarker = config->GetnMarker_All();
+  const auto Exponent = config->GetDeform_IDW_Exponent();
+
+  /*--- In SU2_DOT the transposed operator maps the volume sensitivities to the boundary. ---*/
+  const bool Transposed = Derivative && (Kind_SU2 == SU2_DOT);
+
+  auto Screen_Output = config->GetDeform_Output();
+  if (Kind_SU2 == SU2_CFD && !Derivative) Screen_Output = false;
+
+  /*--- Boundary points with an imposed displacement are the sources of the interpolation,
+   the markers are processed in the same order as in SetBoundaryDisplacements. Symmetry
+   planes are interpolated like the volume, the normal displacement is removed after. ---*/
+
+  vector<bool> IsSource(nPoint, false);
+  LinSysSol.SetValZero();
+
+  auto FixMarker = [&](unsigned short iMarker) {
+    for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      IsSource[iPoint] = true;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) LinSysSol[iPoint*nDim+iDim] = 0.0;
+    }
+  };
+
+  auto MoveMarker = [&](unsigned short iMarker) {
+    const bool isDV = (config->GetMarker_All_DV(iMarker) == YES);
+    for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const su2double* VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+      IsSource[iPoint] = true;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        su2double disp = VarCoord[iDim];
+        if (Derivative) disp = isDV? SU2_TYPE::GetDerivative(VarCoord[iDim]) : 0.0;
+        LinSysSol[iPoint*nDim+iDim] = disp;
+      }
+    }
+  };
+
+  vector<short> SymAxis(nMarker, -1);
+
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    const auto KindBC = config->GetMarker_All_KindBC(iMarker);
+    if ((KindBC != SYMMETRY_PLANE) && (KindBC != SEND_RECEIVE) &&
+        (KindBC != INTERNAL_BOUNDARY) && (KindBC != PERIODIC_BOUNDARY)) FixMarker(iMarker);
+  }
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (((config->GetMarker_All_Moving(iMarker) == YES) && (Kind_SU2 == SU2_CFD)) ||
+        ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_DEF)) ||
+        ((config->GetDirectDiff() == D_DESIGN) && (Kind_SU2 == SU2_CFD) && (config->GetMarker_All_DV(iMarker) == YES)) ||
+        ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_DOT))) MoveMarker(iMarker);
+  }
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == SYMMETRY_PLANE) {
+      SymAxis[iMarker] = GetSymmetryAxis(geometry, iMarker);
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
+        LinSysSol[geometry->vertex[iMarker][iVertex]->GetNode()*nDim + SymAxis[iMarker]] = 0.0;
+    }
+  }
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) FixMarker(iMarker);
+  }
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    if ((config->GetMarker_All_ZoneInterface(iMarker) == YES) && (Kind_SU2 == SU2_CFD)) MoveMarker(iMarker);
+  }
+
+  /*--- Points that are not allowed to move (SetDomainDisplacements). ---*/
+
+  if (config->GetDeform_Limit() < 1E6) {
+    su2double MinDistance = 0.0, MaxDistance = 0.0;
+    ComputeSolid_Wall_Distance(geometry, config, MinDistance, MaxDistance);
+  }
+  const su2double* Hold_Coord = config->GetHold_GridFixed_Coord();
+
+  auto IsHeld = [&](unsigned long iPoint, unsigned short iDim) {
+    if (config->GetHold_GridFixed()) {
+      const su2double coord = geometry->nodes->GetCoord(iPoint, iDim);
+      if ((coord < Hold_Coord[iDim]) || (coord > Hold_Coord[iDim+3])) return true;
+    }
+    return (config->GetDeform_Limit() < 1E6) &&
+           (geometry->nodes->GetWall_Distance(iPoint) >= config->GetDeform_Limit());
+  };
+
+  /*--- Remove the displacement components that are constrained, for the interpolated points. ---*/
+
+  auto ApplyConstraints = [&](CSysVector<su2double>& vec) {
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+      if (SymAxis[iMarker] < 0) continue;
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (!IsSource[iPoint]) vec[iPoint*nDim + SymAxis[iMarker]] = 0.0;
+      }
+    }
+    SU2_OMP_PARALLEL_(for schedule(static,omp_chunk_size))
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      if (IsSource[iPoint]) continue;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        if (IsHeld(iPoint, iDim)) vec[iPoint*nDim+iDim] = 0.0;
+    }
+  };
+
+  /*--- Gather the sources owned by each rank (coordinates and displacements) on all ranks. ---*/
+
+  vector<unsigned long> LocalSources;
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    if (IsSource[iPoint]) LocalSources.push_back(iPoint);
+
+  vector<su2double> LocalBuffer(2*nDim*LocalSources.size());
+  for (auto k = 0ul; k < LocalSources.size(); ++k) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      LocalBuffer[2*nDim*k + iDim] = geometry->nodes->GetCoord(LocalSources[k], iDim);
+      LocalBuffer[2*nDim*k + nDim + iDim] = LinSysSol[LocalSources[k]*nDim + iDim];
+    }
+  }
+
+  vector<int> RecvCounts(size), Displs(size, 0);
+  int nLocalBuffer = LocalBuffer.size();
+  SU2_MPI::Allgather(&nLocalBuffer, 1, MPI_INT, RecvCounts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  for (int iRank = 1; iRank < size; iRank++) Displs[iRank] = Displs[iRank-1] + RecvCounts[iRank-1];
+
+  const unsigned long nSource = (Displs[size-1] + RecvCounts[size-1]) / (2*nDim);
+  const unsigned long FirstSource = Displs[rank] / (2*nDim);
+
+  vector<su2double> SourceBuffer(2*nDim*nSource);
+  SU2_MPI::Allgatherv(LocalBuffer.data(), nLocalBuffer, MPI_DOUBLE, SourceBuffer.data(),
+                      RecvCounts.data(), Displs.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+  su2activematrix SourceCoord(nSource, nDim), SourceDisp(nSource, nDim);
+  vector<unsigned long> SourceID(nSource);
+  for (auto iSource = 0ul; iSource < nSource; ++iSource) {
+    SourceID[iSource] = iSource;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      SourceCoord(iSource, iDim) = SourceBuffer[2*nDim*iSource + iDim];
+      SourceDisp(iSource, iDim) = SourceBuffer[2*nDim*iSource + nDim + iDim];
+    }
+  }
+
+  if (rank == MASTER_NODE && Screen_Output)
+    cout << "Inverse distance weighting deformation from " << nSource << " boundary points." << endl;
+
+  /*--- Tree of the sources and interpolation of the other points, the weights of the nearest
+   sources are tapered by the distance to the next one, so that a source entering or leaving
+   the set of neighbors does not make the displacement field discontinuous. ---*/
+
+  const unsigned long nNeighbor = max<unsigned long>(config->GetDeform_IDW_Neighbors(), 1);
+  const unsigned long nSearch = (nSource > nNeighbor)? nNeighbor+1 : nSource;
+
+  /*--- For the transposed operator LinSysSol holds the sensitivities, constrained like the displacements. ---*/
+
+  vector<su2double> SourceSens;
+  if (Transposed) {
+    SourceSens.resize(nSource*nDim, 0.0);
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        LinSysSol[iPoint*nDim+iDim] = SU2_TYPE::GetValue(geometry->GetSensitivity(iPoint, iDim));
+
+    ApplyConstraints(LinSysSol);
+  }
+
+  if (nSource > 0) {
+
+    CADTPointsOnlyClass SourceADT(nDim, nSource, SourceCoord.data(), SourceID.data(), false);
+
+    SU2_OMP_PARALLEL
+    {
+    vector<su2double> Dist, Weight, ThreadSens;
+    vector<unsigned long> Neighbor;
+    vector<int> NeighborRank;
+    if (Transposed) ThreadSens.resize(nSource*nDim, 0.0);
+
+    /*--- Only the owned points contribute to the transposed operator. ---*/
+    const auto nPointLoop = Transposed? nPointDomain : nPoint;
+
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (unsigned long iPoint = 0; iPoint < nPointLoop; iPoint++) {
+
+      if (IsSource[iPoint]) continue;
+
+      const su2double* Coord = geometry->nodes->GetCoord(iPoint);
+      SourceADT.DetermineNearestNodes(Coord, nSearch, Dist, Neighbor, NeighborRank);
+
+      /*--- Distances are recomputed from the coordinates, the search is passive. ---*/
+
+      const auto nNear = Neighbor.size();
+      Weight.resize(nNear);
+      for (auto i = 0ul; i < nNear; ++i) {
+        su2double dist2 = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          dist2 += pow(Coord[iDim] - SourceCoord(Neighbor[i], iDim), 2);
+        Weight[i] = sqrt(dist2);
+      }
+      const su2double Radius = Weight[nNear-1];
+      const bool Taper = (nNear == nNeighbor+1) && (Radius > Weight[0]);
+
+      su2double WeightSum = 0.0;
+      for (auto i = 0ul; i < nNear; ++i) {
+        const su2double dist = Weight[i];
+        Weight[i] = pow(max(dist, su2double(EPS)), -Exponent);
+        if (Taper) Weight[i] *= pow(1.0 - dist/Radius, 2);
+        WeightSum += Weight[i];
+      }
+
+      for (auto i = 0ul; i < nNear; ++i) {
+        const su2double w = Weight[i] / WeightSum;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          if (!Transposed) LinSysSol[iPoint*nDim+iDim] += w * SourceDisp(Neighbor[i], iDim);
+          else ThreadSens[Neighbor[i]*nDim+iDim] += w * LinSysSol[iPoint*nDim+iDim];
+        }
+      }
+    }
+
+    if (Transposed) {
+      SU2_OMP_CRITICAL
+      for (auto i = 0ul; i < nSource*nDim; ++i) SourceSens[i] += ThreadSens[i];
+    }
+    } // end SU2_OMP_PARALLEL
+  }
+
+  if (!Transposed) {
+
+    ApplyConstraints(LinSysSol);
+
+    if (!Derivative) UpdateGridCoord(geometry, config);
+    else UpdateGridCoord_Derivatives(geometry, config);
+  }
+  else {
+
+    /*--- The volume contributions are summed over all ranks and added to the owned sources. ---*/
+
+    vector<su2double> SourceSensTotal(nSource*nDim);
+    SU2_MPI::Allreduce(SourceSens.data(), SourceSensTotal.data(), nSource*nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+    for (auto k = 0ul; k < LocalSources.size(); ++k)
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        LinSysSol[LocalSources[k]*nDim+iDim] += SourceSensTotal[(FirstSource+k)*nDim+iDim];
+
+    UpdateGridCoord_Derivatives(geometry, config);
+  }
+
+  if (!Derivative) {
+    if (UpdateGeo) UpdateDualGrid(geometry, config);
+
+    /*--- Check for failed deformation (negative volumes). ---*/
+
+    su2double MinVolume, MaxVolume;
+    ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume, Screen_Output);
+
+    if (rank == MASTER_NODE && Screen_Output) {
+      if (nDim == 2) cout << "Min. area: " << MinVolume << "." << endl;
+      else cout << "Min. volume: " << MinVolume << "." << endl;
+    }
+  }
+
+  Set_nIterMesh(0);
+
+}
+
 void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, su2double &MinVolume, su2double &MaxVolume, bool Screen_Output) {
 
   unsigned long iElem, ElemCounter = 0, PointCorners[8];
@@ -395,10 +735,8 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
 
 su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometry, CConfig *config) {
 
-  unsigned short iVar, iDim, nNodes = 0, iNodes, StiffMatrix_nElem = 0;
-  unsigned long iElem, PointCorners[8];
-  su2double **StiffMatrix_Elem = nullptr, CoordCorners[8][3];
-  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0, ElemVolume = 0.0, ElemDistance = 0.0;
+  unsigned short StiffMatrix_nElem = 0;
+  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0;
 
   bool Screen_Output  = config->GetDeform_Output();
 
@@ -407,10 +745,6 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
   if (nDim == 2) StiffMatrix_nElem = 8;
   else StiffMatrix_nElem = 24;
 
-  StiffMatrix_Elem = new su2double* [StiffMatrix_nElem];
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
-    StiffMatrix_Elem[iVar] = new su2double [StiffMatrix_nElem];
-
   /*--- Compute min volume in the entire mesh. ---*/
 
   ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume, Screen_Output);
@@ -425,48 +759,76 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
     if (rank == MASTER_NODE && Screen_Output) cout <<"Min. distance: "<< MinDistance <<", max. distance: "<< MaxDistance <<"." << endl;
   }
 
-  /*--- Compute contributions from each element by forming the stiffness matrix (FEA) ---*/
+  const bool wallDistStiffness = (config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE);
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+  /*--- Compute contributions from each element by forming the stiffness matrix (FEA).
+   Elements of the same color do not share points, hence they can be assembled
+   concurrently, otherwise (poor coloring) the rows are guarded by locks. ---*/
 
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    nNodes = 8;
+  SU2_OMP_PARALLEL
+  {
+  StiffMatrix.SetValZero();
 
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+  /*--- Element stiffness matrix, one per thread. ---*/
+
+  su2double **StiffMatrix_Elem = new su2double* [StiffMatrix_nElem];
+  for (unsigned short iVar = 0; iVar < StiffMatrix_nElem; iVar++)
+    StiffMatrix_Elem[iVar] = new su2double [StiffMatrix_nElem];
+
+  /*--- The matrix must be fully cleared before any thread adds to it. ---*/
+  SU2_OMP_BARRIER
+
+  for(auto color : ElemColoring) {
+
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for(auto k = 0ul; k < color.size; ++k) {
+
+      const auto iElem = color.indices[k];
+
+      unsigned short nNodes = 0;
+      unsigned long PointCorners[8];
+      su2double CoordCorners[8][3], ElemDistance = 0.0;
+
+      if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
+      if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       nNodes = 5;
+      if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         nNodes = 6;
+      if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    nNodes = 8;
+
+      for (unsigned short iNodes = 0; iNodes < nNodes; iNodes++) {
+        PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+        }
       }
-    }
 
-    /*--- Extract Element volume and distance to compute the stiffness ---*/
+      /*--- Extract Element volume and distance to compute the stiffness ---*/
 
-    ElemVolume = geometry->elem[iElem]->GetVolume();
+      const su2double ElemVolume = geometry->elem[iElem]->GetVolume();
 
-    if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE)) {
-      ElemDistance = 0.0;
-      for (iNodes = 0; iNodes < nNodes; iNodes++)
-        ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNodes]);
-      ElemDistance = ElemDistance/(su2double)nNodes;
-    }
+      if (wallDistStiffness) {
+        for (unsigned short iNodes = 0; iNodes < nNodes; iNodes++)
+          ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNodes]);
+        ElemDistance = ElemDistance/(su2double)nNodes;
+      }
 
-    if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
-    if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+      if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+      if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
 
-    AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
+      AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
 
-  }
+    }
+  } // end color loop
 
   /*--- Deallocate memory and exit ---*/
 
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
+  for (unsigned short iVar = 0; iVar < StiffMatrix_nElem; iVar++)
     delete [] StiffMatrix_Elem[iVar];
   delete [] StiffMatrix_Elem;
 
+  } // end SU2_OMP_PARALLEL
+
   return MinVolume;
 
 }
@@ -1457,45 +1819,39 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double **St
 
   unsigned short nVar = geometry->GetnDim();
 
-  su2double **StiffMatrix_Node;
-  StiffMatrix_Node = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    StiffMatrix_Node[iVar] = new su2double [nVar];
+  /*--- Node block (row-major) on the stack, this is called concurrently by multiple threads. ---*/
 
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++)
-      StiffMatrix_Node[iVar][jVar] = 0.0;
+  su2double StiffMatrix_Node[9] = {0.0};
 
   /*--- Transform the stiffness matrix for the hexahedral element into the
    contributions for the individual nodes relative to each other. ---*/
 
   for (iVar = 0; iVar < nNodes; iVar++) {
+
+    if (LockStrategy) omp_set_lock(&UpdateLocks[PointCorners[iVar]]);
+
     for (jVar = 0; jVar < nNodes; jVar++) {
 
       for (iDim = 0; iDim < nVar; iDim++) {
         for (jDim = 0; jDim < nVar; jDim++) {
-          StiffMatrix_Node[iDim][jDim] = StiffMatrix_Elem[(iVar*nVar)+iDim][(jVar*nVar)+jDim];
+          StiffMatrix_Node[iDim*nVar+jDim] = StiffMatrix_Elem[(iVar*nVar)+iDim][(jVar*nVar)+jDim];
         }
       }
 
       StiffMatrix.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
 
     }
-  }
 
-  /*--- Deallocate memory and exit ---*/
-
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] StiffMatrix_Node[iVar];
-  delete [] StiffMatrix_Node;
+    if (LockStrategy) omp_unset_lock(&UpdateLocks[PointCorners[iVar]]);
+  }
 
 }
 
 void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config) {
 
-  unsigned short iDim, nDim = geometry->GetnDim(), iMarker, axis = 0;
-  unsigned long iPoint, total_index, iVertex;
-  su2double *VarCoord, MeanCoord[3] = {0.0,0.0,0.0}, VarIncrement = 1.0;
+  const unsigned short nDim = geometry->GetnDim();
+  unsigned short axis = 0;
+  su2double VarIncrement = 1.0;
 
   /*--- Get the SU2 module. SU2_CFD will use this routine for dynamically
    deforming meshes (MARKER_MOVING), while SU2_DEF will use it for deforming
@@ -1509,22 +1865,43 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
 
   VarIncrement = 1.0/((su2double)config->GetGridDef_Nonlinear_Iter());
 
+  /*--- Helpers to clamp or impose the displacement of a vertex, each only touches
+   the rows of its own point, hence the vertex loops are shared by the threads.
+   The marker loops stay in order (the "for" barriers) as later markers overwrite
+   the values set by earlier ones on shared points. ---*/
+
+  auto FixVertex = [&](unsigned long iPoint, unsigned short iDim) {
+    const auto total_index = iPoint*nDim + iDim;
+    LinSysRes[total_index] = 0.0;
+    LinSysSol[total_index] = 0.0;
+    StiffMatrix.DeleteValsRowi(total_index);
+  };
+
+  auto MoveVertex = [&](unsigned short iMarker, unsigned long iVertex) {
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    const su2double* VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      const auto total_index = iPoint*nDim + iDim;
+      LinSysRes[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
+      LinSysSol[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
+      StiffMatrix.DeleteValsRowi(total_index);
+    }
+  };
+
+  SU2_OMP_PARALLEL
+  {
   /*--- As initialization, set to zero displacements of all the surfaces except the symmetry
    plane, internal and periodic bc the receive boundaries and periodic boundaries. ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (((config->GetMarker_All_KindBC(iMarker) != SYMMETRY_PLANE) &&
          (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) &&
          (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
          (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY))) {
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          total_index = iPoint*nDim + iDim;
-          LinSysRes[total_index] = 0.0;
-          LinSysSol[total_index] = 0.0;
-          StiffMatrix.DeleteValsRowi(total_index);
-        }
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) FixVertex(iPoint, iDim);
       }
     }
   }
@@ -1532,98 +1909,86 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
   /*--- Set the known displacements, note that some points of the moving surfaces
    could be on on the symmetry plane, we should specify DeleteValsRowi again (just in case) ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (((config->GetMarker_All_Moving(iMarker) == YES) && (Kind_SU2 == SU2_CFD)) ||
         ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_DEF)) ||
         ((config->GetDirectDiff() == D_DESIGN) && (Kind_SU2 == SU2_CFD) && (config->GetMarker_All_DV(iMarker) == YES)) ||
         ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_DOT))) {
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          total_index = iPoint*nDim + iDim;
-          LinSysRes[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
-          LinSysSol[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
-          StiffMatrix.DeleteValsRowi(total_index);
-        }
-      }
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
+        MoveVertex(iMarker, iVertex);
     }
   }
 
   /*--- Set to zero displacements of the normal component for the symmetry plane condition ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_KindBC(iMarker) == SYMMETRY_PLANE) ) {
 
-      su2double *Coord_0 = nullptr;
-
-      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = 0.0;
-
-      /*--- Store the coord of the first point to help identify the axis. ---*/
-
-      iPoint  = geometry->vertex[iMarker][0]->GetNode();
-      Coord_0 = geometry->nodes->GetCoord(iPoint);
+      /*--- The axis is identified by one thread. ---*/
 
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        VarCoord = geometry->nodes->GetCoord(iPoint);
-        for (iDim = 0; iDim < nDim; iDim++)
-          MeanCoord[iDim] += (VarCoord[iDim]-Coord_0[iDim])*(VarCoord[iDim]-Coord_0[iDim]);
-      }
-      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
-      if (nDim==3) {
-        if ((MeanCoord[0] <= MeanCoord[1]) && (MeanCoord[0] <= MeanCoord[2])) axis = 0;
-        if ((MeanCoord[1] <= MeanCoord[0]) && (MeanCoord[1] <= MeanCoord[2])) axis = 1;
-        if ((MeanCoord[2] <= MeanCoord[0]) && (MeanCoord[2] <= MeanCoord[1])) axis = 2;
-      }
-      else {
-        if ((MeanCoord[0] <= MeanCoord[1]) ) axis = 0;
-        if ((MeanCoord[1] <= MeanCoord[0]) ) axis = 1;
-      }
+      SU2_OMP_MASTER
+      axis = GetSymmetryAxis(geometry, iMarker);
+      SU2_OMP_BARRIER
 
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        total_index = iPoint*nDim + axis;
-        LinSysRes[total_index] = 0.0;
-        LinSysSol[total_index] = 0.0;
-        StiffMatrix.DeleteValsRowi(total_index);
-      }
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
+        FixVertex(geometry->vertex[iMarker][iVertex]->GetNode(), axis);
     }
   }
 
   /*--- Don't move the nearfield plane ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          total_index = iPoint*nDim + iDim;
-          LinSysRes[total_index] = 0.0;
-          LinSysSol[total_index] = 0.0;
-          StiffMatrix.DeleteValsRowi(total_index);
-        }
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) FixVertex(iPoint, iDim);
       }
     }
   }
 
   /*--- Move the FSI interfaces ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_ZoneInterface(iMarker) == YES) && (Kind_SU2 == SU2_CFD)) {
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          total_index = iPoint*nDim + iDim;
-          LinSysRes[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
-          LinSysSol[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
-          StiffMatrix.DeleteValsRowi(total_index);
-        }
-      }
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
+        MoveVertex(iMarker, iVertex);
     }
   }
+  } // end SU2_OMP_PARALLEL
+
+}
+
+unsigned short CVolumetricMovement::GetSymmetryAxis(CGeometry *geometry, unsigned short iMarker) const {
 
+  unsigned short axis = 0;
+  su2double MeanCoord[3] = {0.0,0.0,0.0};
+
+  if (geometry->nVertex[iMarker] == 0) return axis;
+
+  /*--- Store the coord of the first point to help identify the axis. ---*/
+
+  const su2double* Coord_0 = geometry->nodes->GetCoord(geometry->vertex[iMarker][0]->GetNode());
+
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+    const su2double* Coord = geometry->nodes->GetCoord(geometry->vertex[iMarker][iVertex]->GetNode());
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      MeanCoord[iDim] += (Coord[iDim]-Coord_0[iDim])*(Coord[iDim]-Coord_0[iDim]);
+  }
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
+  if (nDim==3) {
+    if ((MeanCoord[0] <= MeanCoord[1]) && (MeanCoord[0] <= MeanCoord[2])) axis = 0;
+    if ((MeanCoord[1] <= MeanCoord[0]) && (MeanCoord[1] <= MeanCoord[2])) axis = 1;
+    if ((MeanCoord[2] <= MeanCoord[0]) && (MeanCoord[2] <= MeanCoord[1])) axis = 2;
+  }
+  else {
+    if ((MeanCoord[0] <= MeanCoord[1]) ) axis = 0;
+    if ((MeanCoord[1] <= MeanCoord[0]) ) axis = 1;
+  }
+  return axis;
 }
 
 void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *config) {
@@ -1704,8 +2069,7 @@ void CVolumetricMovement::UpdateGridCoord_Derivatives(CGeometry *geometry, CConf
 void CVolumetricMovement::SetDomainDisplacements(CGeometry *geometry, CConfig *config) {
 
   unsigned short iDim, nDim = geometry->GetnDim();
-  unsigned long iPoint, total_index;
-  su2double *Coord, *MinCoordValues, *MaxCoordValues, *Hold_GridFixed_Coord;
+  su2double *MinCoordValues, *MaxCoordValues, *Hold_GridFixed_Coord;
 
   if (config->GetHold_GridFixed()) {
 
@@ -1729,11 +2093,12 @@ void CVolumetricMovement::SetDomainDisplacements(CGeometry *geometry, CConfig *c
     /*--- Set to zero displacements of all the points that are not going to be moved
      except the surfaces ---*/
 
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-      Coord = geometry->nodes->GetCoord(iPoint);
-      for (iDim = 0; iDim < nDim; iDim++) {
+    SU2_OMP_PARALLEL_(for schedule(static,omp_chunk_size))
+    for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      const su2double* Coord = geometry->nodes->GetCoord(iPoint);
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
         if ((Coord[iDim] < MinCoordValues[iDim]) || (Coord[iDim] > MaxCoordValues[iDim])) {
-          total_index = iPoint*nDim + iDim;
+          const auto total_index = iPoint*nDim + iDim;
           LinSysRes[total_index] = 0.0;
           LinSysSol[total_index] = 0.0;
           StiffMatrix.DeleteValsRowi(total_index);
@@ -1750,10 +2115,11 @@ void CVolumetricMovement::SetDomainDisplacements(CGeometry *geometry, CConfig *c
    on the distance to the solid surface ---*/
 
   if (config->GetDeform_Limit() < 1E6) {
-    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    SU2_OMP_PARALLEL_(for schedule(static,omp_chunk_size))
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
       if (geometry->nodes->GetWall_Distance(iPoint) >= config->GetDeform_Limit()) {
-        for (iDim = 0; iDim < nDim; iDim++) {
-          total_index = iPoint*nDim + iDim;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          const auto total_index = iPoint*nDim + iDim;
           LinSysRes[total_index] = 0.0;
           LinSysSol[total_index] = 0.0;
           StiffMatrix.DeleteValsRowi(total_index);
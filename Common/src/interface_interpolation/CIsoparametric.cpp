@@ -30,6 +30,7 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include <unordered_map>
 
 using namespace GeometryToolbox;
@@ -170,6 +171,14 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
       }
     }
 
+    /*--- Build an ADT of the donor vertices to find the closest one to each target,
+     *    the compressed index is the point ID. In case of ties, the vertex returned is
+     *    the one found first in the traversal of the tree (not a defined order). ---*/
+    vector<unsigned long> donorPointID(nGlobalVertexDonor);
+    iota(donorPointID.begin(), donorPointID.end(), 0ul);
+
+    CADTPointsOnlyClass donorADT(nDim, nGlobalVertexDonor, donorCoord.data(), donorPointID.data(), false);
+
     /*--- Compute transfer coefficients for each target point. ---*/
     SU2_OMP_PARALLEL
     {
@@ -190,13 +199,11 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
 
       /*--- Find the closest donor vertex. ---*/
       su2double minDist = 1e9;
-      unsigned iClosestVertex = 0;
-      for (auto iVertexDonor = 0u; iVertexDonor < nGlobalVertexDonor; ++iVertexDonor) {
-        su2double d = SquaredDistance(nDim, coord_i, donorCoord[iVertexDonor]);
-        if (d < minDist) {
-          minDist = d;
-          iClosestVertex = iVertexDonor;
-        }
+      unsigned long iClosestVertex = 0;
+      if (!donorADT.IsEmpty()) {
+        int rankID;
+        donorADT.DetermineNearestNode(coord_i, minDist, iClosestVertex, rankID);
+        minDist *= minDist;
       }
 
       if (minDist < matchingVertexTol) {
@@ -29,17 +29,9 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 
 
-/*! \brief Helper struct to (partially) sort neighbours according to distance while
- *         keeping track of the origin of the point (i.e. index and processor). */
-struct DonorInfo {
-  su2double dist;
-  unsigned pidx;
-  int proc;
-  DonorInfo(su2double d = 0.0, unsigned i = 0, int p = 0) : dist(d), pidx(i), proc(p) { }
-};
-
 CNearestNeighbor::CNearestNeighbor(CGeometry ****geometry_container, const CConfig* const* config,
                                    unsigned int iZone, unsigned int jZone) :
   CInterpolator(geometry_container, config, iZone, jZone) {
@@ -67,8 +59,6 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
 
-  vector<vector<DonorInfo> > DonorInfoVec(omp_get_max_threads());
-
   /*--- Cycle over nMarkersInt interface to determine communication pattern. ---*/
 
   AvgDistance = MaxDistance = 0.0;
@@ -104,12 +94,38 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     /*--- Collect coordinates and global point indices. ---*/
     Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
 
+    /*--- Sort the donor points according to their global index and build an ADT
+     *    of them, with the position in the sorted order as point ID. In this way
+     *    ties in the distance are broken by the global index, which makes the
+     *    result independent of the partitioning. ---*/
+    vector<unsigned long> donorIdx;
+    donorIdx.reserve(nPossibleDonor);
+    for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor)
+      for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex)
+        donorIdx.push_back(iProcessor*MaxLocalVertex_Donor + jVertex);
+
+    sort(donorIdx.begin(), donorIdx.end(), [&](unsigned long a, unsigned long b) {
+      return Buffer_Receive_GlobalPoint[a] < Buffer_Receive_GlobalPoint[b];
+    });
+
+    su2activematrix donorCoord(nPossibleDonor, nDim);
+    vector<unsigned long> donorPointID(nPossibleDonor);
+
+    for (auto iDonor = 0ul; iDonor < nPossibleDonor; ++iDonor) {
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        donorCoord(iDonor,iDim) = Buffer_Receive_Coord[donorIdx[iDonor]*nDim + iDim];
+      donorPointID[iDonor] = iDonor;
+    }
+
+    CADTPointsOnlyClass donorADT(nDim, nPossibleDonor, donorCoord.data(), donorPointID.data(), false);
+
     /*--- Find the closest donor points to each target. ---*/
     SU2_OMP_PARALLEL
     {
-    /*--- Working array for this thread. ---*/
-    auto& donorInfo = DonorInfoVec[omp_get_thread_num()];
-    donorInfo.resize(nPossibleDonor);
+    /*--- Working arrays for this thread. ---*/
+    vector<su2double> donorDist;
+    vector<unsigned long> donorID;
+    vector<int> donorRank;
 
     su2double avgDist = 0.0, maxDist = 0.0;
     unsigned long numTarget = 0;
@@ -125,47 +141,32 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
       /*--- Coordinates of the target point. ---*/
       const su2double* Coord_i = target_geometry->nodes->GetCoord(Point_Target);
 
-      /*--- Compute all distances. ---*/
-      for (int iProcessor = 0, iDonor = 0; iProcessor < nProcessor; ++iProcessor) {
-        for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex) {
-
-          const auto idx = iProcessor*MaxLocalVertex_Donor + jVertex;
-          const auto pGlobalPoint = Buffer_Receive_GlobalPoint[idx];
-          const su2double* Coord_j = &Buffer_Receive_Coord[idx*nDim];
-          const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, Coord_j);
-
-          donorInfo[iDonor++] = DonorInfo(dist2, pGlobalPoint, iProcessor);
-        }
-      }
-
-      /*--- Find k closest points (need to define the comparator inline or debug build give wrong results). ---*/
-      partial_sort(donorInfo.begin(), donorInfo.begin()+nDonor, donorInfo.end(),
-        [](const DonorInfo& a, const DonorInfo& b) {
-          /*--- Global index is used as tie-breaker to make sorted order independent of initial. ---*/
-          return (a.dist != b.dist)? (a.dist < b.dist) : (a.pidx < b.pidx);
-        }
-      );
+      /*--- Find the k closest points (sorted by distance). ---*/
+      donorADT.DetermineNearestNodes(Coord_i, nDonor, donorDist, donorID, donorRank);
+      const auto nFound = donorID.size();
+      if (nFound == 0) continue;
 
       /*--- Update stats. ---*/
       numTarget += 1;
-      su2double d = sqrt(donorInfo[0].dist);
+      su2double d = donorDist[0];
       avgDist += d;
       maxDist = max(maxDist, d);
 
       /*--- Compute interpolation numerators and denominator. ---*/
       su2double denom = 0.0;
-      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
-        donorInfo[iDonor].dist = 1.0 / (donorInfo[iDonor].dist + eps);
-        denom += donorInfo[iDonor].dist;
+      for (auto iDonor = 0ul; iDonor < nFound; ++iDonor) {
+        donorDist[iDonor] = 1.0 / (pow(donorDist[iDonor], 2) + eps);
+        denom += donorDist[iDonor];
       }
 
       /*--- Set interpolation coefficients. ---*/
-      target_vertex.resize(nDonor);
+      target_vertex.resize(nFound);
 
-      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
-        target_vertex.globalPoint[iDonor] = donorInfo[iDonor].pidx;
-        target_vertex.processor[iDonor] = donorInfo[iDonor].proc;
-        target_vertex.coefficient[iDonor] = donorInfo[iDonor].dist/denom;
+      for (auto iDonor = 0ul; iDonor < nFound; ++iDonor) {
+        const auto idx = donorIdx[donorID[iDonor]];
+        target_vertex.globalPoint[iDonor] = Buffer_Receive_GlobalPoint[idx];
+        target_vertex.processor[iDonor] = idx / MaxLocalVertex_Donor;
+        target_vertex.coefficient[iDonor] = donorDist[iDonor]/denom;
       }
     }
     SU2_OMP_CRITICAL
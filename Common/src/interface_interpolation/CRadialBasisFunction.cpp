@@ -60,6 +60,8 @@ void CRadialBasisFunction::PrintStatistics() const {
   if (MaxCorrection < 1.1 || AvgCorrection < 1.02) cout << " (ok)\n";
   else if (MaxCorrection < 2.0 && AvgCorrection < 1.05) cout << " (warning)\n";
   else cout << " <<< WARNING >>>\n";
+  if (NumCenters < NumDonorPoints)
+    cout << "  Greedy selection uses " << NumCenters << " of " << NumDonorPoints << " donor points as RBF centers.\n";
   cout << "  Interpolation matrix is " << Density << "% dense." << endl;
   cout.unsetf(ios::floatfield);
 }
@@ -101,6 +103,13 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
   const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
   const su2double pruneTol = config[donorZone]->GetRadialBasisFunctionPruneTol();
+  const passivedouble greedyTol = SU2_TYPE::GetValue(config[donorZone]->GetRadialBasisFunctionGreedyTol());
+  const auto maxCenters = config[donorZone]->GetRadialBasisFunctionMaxCenters();
+  const bool useGreedy = (greedyTol > 0.0);
+
+  if (useGreedy && (kindRBF != WENDLAND_C2) && (kindRBF != GAUSSIAN) && (kindRBF != INV_MULTI_QUADRIC))
+    SU2_MPI::Error("The greedy selection of RBF centers requires a positive definite kernel\n"
+                   "(WENDLAND_C2, GAUSSIAN, or INV_MULTI_QUADRIC).", CURRENT_FUNCTION);
 
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
   const int nDim = donor_geometry->GetnDim();
@@ -120,6 +129,23 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   vector<vector<int> > donorProcessor(nMarkerInt);
   vector<int> assignedProcessor(nMarkerInt,-1);
   vector<unsigned long> totalWork(nProcessor,0);
+  NumDonorPoints = 0;
+
+  /*--- Reduce the donor information to the selected centers. ---*/
+  auto CompressToCenters = [nDim](const vector<unsigned long>& centers, su2activematrix& coord,
+                                  vector<long>& point, vector<int>& proc) {
+    su2activematrix centerCoord(centers.size(), nDim);
+    for (auto iCenter = 0ul; iCenter < centers.size(); ++iCenter) {
+      const auto iVertex = centers[iCenter];
+      for (int iDim = 0; iDim < nDim; ++iDim)
+        centerCoord(iCenter,iDim) = coord(iVertex,iDim);
+      point[iCenter] = point[iVertex];
+      proc[iCenter] = proc[iVertex];
+    }
+    coord = move(centerCoord);
+    point.resize(centers.size());
+    proc.resize(centers.size());
+  };
 
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
 
@@ -192,12 +218,21 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
         swap(donorCoord(i,iDim), donorCoord(j,iDim));
     }
 
+    NumDonorPoints += nGlobalVertexDonor;
+
+    /*--- The greedy selection is shared by all ranks, after it only the centers are kept. ---*/
+    if (useGreedy) {
+      const auto centers = SelectCentersGreedy(kindRBF, paramRBF, donorCoord, greedyTol, maxCenters);
+      CompressToCenters(centers, donorCoord, donorPoint, donorProc);
+    }
+
     /*--- Static work scheduling over ranks based on which one has less work currently. ---*/
     int iProcessor = 0;
     for (int i = 1; i < nProcessor; ++i)
       if (totalWork[i] < totalWork[iProcessor]) iProcessor = i;
 
-    totalWork[iProcessor] += pow(nGlobalVertexDonor,3); // based on matrix inversion.
+    /*--- Based on matrix inversion. ---*/
+    totalWork[iProcessor] += pow(donorCoord.rows(),3);
 
     assignedProcessor[iMarkerInt] = iProcessor;
 
@@ -224,6 +259,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   /*--- Initialize variables for interpolation statistics. ---*/
   unsigned long totalTargetPoints = 0, totalDonorPoints = 0, denseSize = 0;
   MinDonors = 1<<30; MaxDonors = 0; MaxCorrection = 0.0; AvgCorrection = 0.0;
+  NumCenters = 0;
 
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
 
@@ -247,6 +283,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     auto& keepPolynomialRow = keepPolynomialRowVec[iMarkerInt];
 
     const auto nGlobalVertexDonor = donorCoord.rows();
+    NumCenters += nGlobalVertexDonor;
 
 #ifdef HAVE_MPI
     /*--- For simplicity, broadcast small information about the interpolation matrix. ---*/
@@ -431,6 +468,92 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
 }
 
+vector<unsigned long> CRadialBasisFunction::SelectCentersGreedy(ENUM_RADIALBASIS type, su2double radius,
+                                                               const su2activematrix& coords, passivedouble tolerance,
+                                                               unsigned long maxCenters) {
+
+  const unsigned long nVertexDonor = coords.rows();
+  const int nDim = coords.cols();
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  if (maxCenters == 0 || maxCenters > nVertexDonor) maxCenters = nVertexDonor;
+
+  /*--- Each rank updates the power function and the Newton basis on a contiguous
+   *    slice of the donor points (which are in the same order on all ranks). ---*/
+  auto SliceBegin = [nVertexDonor, size](int iRank) { return (nVertexDonor * iRank) / size; };
+  const auto begin = SliceBegin(rank);
+  const auto nLocal = SliceBegin(rank+1) - begin;
+
+  /*--- The squared power function is initially the value of the RBF at distance 0,
+   *    it is reduced by the square of each new Newton basis function. ---*/
+  const passivedouble phi0 = SU2_TYPE::GetValue(Get_RadialBasisValue(type, radius, 0.0));
+  const passivedouble tol2 = tolerance * tolerance * phi0;
+
+  vector<passivedouble> power2(nLocal, phi0);
+  vector<vector<passivedouble> > newtonBasis;
+  vector<passivedouble> centerBasis;
+  vector<unsigned long> centers;
+
+  /*--- Layout of MPI_DOUBLE_INT. ---*/
+  struct { passivedouble val; int idx; } localMax, globalMax;
+
+  while (centers.size() < maxCenters) {
+
+    /*--- The next center is where the power function is maximum, ties go to the lowest
+     *    index (on each rank and in MPI_MAXLOC) so the selection is MPI-independent. ---*/
+    localMax.val = -numeric_limits<passivedouble>::max();
+    localMax.idx = 0;
+    if (nLocal > 0) {
+      const auto iLocal = max_element(power2.begin(), power2.end()) - power2.begin();
+      localMax.val = power2[iLocal];
+      localMax.idx = begin + iLocal;
+    }
+    globalMax = localMax;
+#ifdef HAVE_MPI
+    SelectMPIWrapper<passivedouble>::W::Allreduce(&localMax, &globalMax, 1, MPI_DOUBLE_INT,
+                                                  MPI_MAXLOC, MPI_COMM_WORLD);
+#endif
+    if (globalMax.val <= tol2) break;
+    const unsigned long iCenter = globalMax.idx;
+
+    /*--- The rank that owns the center sends the values of the previous basis functions there. ---*/
+    const auto nCenters = centers.size();
+    int owner = 0;
+    while (SliceBegin(owner+1) <= iCenter) ++owner;
+
+    centerBasis.resize(nCenters);
+    if (rank == owner) {
+      for (auto k = 0ul; k < nCenters; ++k)
+        centerBasis[k] = newtonBasis[k][iCenter-begin];
+    }
+#ifdef HAVE_MPI
+    SelectMPIWrapper<passivedouble>::W::Bcast(centerBasis.data(), nCenters, MPI_DOUBLE, owner, MPI_COMM_WORLD);
+#endif
+
+    /*--- Newton basis function of the new center, orthogonal to the previous ones. ---*/
+    const passivedouble scale = 1.0 / sqrt(globalMax.val);
+    vector<passivedouble> basis(nLocal);
+
+    for (auto iLocal = 0ul; iLocal < nLocal; ++iLocal) {
+      passivedouble val = SU2_TYPE::GetValue(Get_RadialBasisValue(type, radius,
+                          GeometryToolbox::Distance(nDim, coords[begin+iLocal], coords[iCenter])));
+      for (auto k = 0ul; k < nCenters; ++k)
+        val -= newtonBasis[k][iLocal] * centerBasis[k];
+      basis[iLocal] = val * scale;
+      power2[iLocal] -= pow(basis[iLocal], 2);
+    }
+    if (rank == owner) power2[iCenter-begin] = 0.0;
+
+    newtonBasis.push_back(move(basis));
+    centers.push_back(iCenter);
+  }
+
+  /*--- Keep the MPI-independent order of the donor points. ---*/
+  sort(centers.begin(), centers.end());
+  return centers;
+}
+
 void CRadialBasisFunction::ComputeGeneratorMatrix(ENUM_RADIALBASIS type, bool usePolynomial,
                            su2double radius, const su2activematrix& coords, int& nPolynomial,
                            vector<int>& keepPolynomialRow, su2passivematrix& C_inv_trunc) {
@@ -29,6 +29,10 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
+
+#include <numeric>
+#include <unordered_map>
 
 
 CSlidingMesh::CSlidingMesh(CGeometry ****geometry_container, const CConfig* const* config,
@@ -60,7 +64,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, *Normal;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
@@ -165,6 +169,39 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
     Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
     Donor_Proc             = Buffer_Receive_Proc;
 
+    /*--- Build an ADT of the donor boundary points, such that the closest donor
+     * node of a target node is found in logarithmic instead of linear time.
+     * Every rank stores the complete donor boundary, hence a local tree suffices. ---*/
+    vector<unsigned long> donorPointIDs(nGlobalVertex_Donor);
+    iota(donorPointIDs.begin(), donorPointIDs.end(), 0);
+
+    CADTPointsOnlyClass donorADT(nDim, nGlobalVertex_Donor, DonorPoint_Coord,
+                                 donorPointIDs.data(), false);
+
+    auto FindClosestDonor = [&](const su2double* coord) {
+      unsigned long pointID = 0;
+      if (!donorADT.IsEmpty()) {
+        su2double dist;
+        int rankID;
+        donorADT.DetermineNearestNode(coord, dist, pointID, rankID);
+      }
+      return pointID;
+    };
+
+    /*--- Map from the global index of a target point to its position in the
+     * reconstructed target boundary, which replaces a linear search. ---*/
+    unordered_map<long, unsigned long> targetGlobalToLocal;
+    targetGlobalToLocal.reserve(nGlobalVertex_Target);
+    for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
+      targetGlobalToLocal.emplace(Target_GlobalPoint[jVertexTarget], jVertexTarget);
+
+    auto FindTargetPoint = [&](long globalIndex) {
+      const auto it = targetGlobalToLocal.find(globalIndex);
+      if (it == targetGlobalToLocal.end())
+        SU2_MPI::Error("Target point not found in the reconstructed boundary.", CURRENT_FUNCTION);
+      return it->second;
+    };
+
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
      * - Then it creates the supermesh in the close proximity of the target point:
@@ -197,37 +234,16 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
           Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
-
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
+          /*--- Find the closest donor_node ---*/
 
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-            dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }
-          }
+          donor_StartIndex = FindClosestDonor(Coord_i);
 
           donor_iPoint    = donor_StartIndex;
           donor_OldiPoint = donor_iPoint;
 
           /*--- Contruct information regarding the target cell ---*/
 
-          long dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
+          jVertexTarget = FindTargetPoint(target_geometry->nodes->GetGlobalIndex(target_iPoint));
 
           if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
             target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
@@ -462,11 +478,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         for (iDim = 0; iDim < nDim; iDim++)
           Coord_i[iDim] = target_geometry->nodes->GetCoord(target_iPoint, iDim);
 
-        long dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-        for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-          if( dPoint == Target_GlobalPoint[target_iPoint] )
-            break;
-        }
+        target_iPoint = FindTargetPoint(target_geometry->nodes->GetGlobalIndex(target_iPoint));
 
         /*--- Build local surface dual mesh for target element ---*/
 
@@ -481,27 +493,9 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes,
                                                 TargetPoint_Coord, target_iPoint, target_element);
 
-        /*--- Brute force to find the closest donor_node ---*/
-
-        mindist = 1E6;
-        donor_StartIndex = 0;
-
-        for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-
-          Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
+        /*--- Find the closest donor_node ---*/
 
-          dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-          if (dist < mindist) {
-            mindist = dist;
-            donor_StartIndex = donor_iPoint;
-          }
-
-          if (dist == 0.0){
-            donor_StartIndex = donor_iPoint;
-            break;
-          }
-        }
+        donor_StartIndex = FindClosestDonor(Coord_i);
 
         donor_iPoint = donor_StartIndex;
 
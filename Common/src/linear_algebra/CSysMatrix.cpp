@@ -42,6 +42,7 @@ CSysMatrix<ScalarType>::CSysMatrix() :
   nPoint = nPointDomain = nVar = nEqn = 0;
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
+  ilu_in_place = false;
   nLinelet = 0;
 
   omp_partitions    = nullptr;
@@ -72,7 +73,7 @@ template<class ScalarType>
 CSysMatrix<ScalarType>::~CSysMatrix(void) {
 
   delete [] omp_partitions;
-  MemoryAllocation::aligned_free(ILU_matrix);
+  if (!ilu_in_place) MemoryAllocation::aligned_free(ILU_matrix);
   MemoryAllocation::aligned_free(matrix);
   MemoryAllocation::aligned_free(invM);
 
@@ -160,6 +161,13 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     nnz_ilu = csr_ilu.getNumNonZeros();
   }
 
+  /*--- ILU(0) of finite volume matrices may be computed in place, the option is not
+   *    applied to the matrices that use other settings (deformation, adjoint). ---*/
+
+  ilu_in_place = ilu_needed && (ilu_fill_in == 0) && (type == ConnectivityType::FiniteVolume) &&
+                 (prec == config->GetKind_Linear_Solver_Prec()) && !config->GetDiscrete_Adjoint() &&
+                 config->GetLinear_Solver_ILU_InPlace();
+
   /*--- Allocate data. ---*/
 #define ALLOC_AND_INIT(ptr,num) {\
   ptr = MemoryAllocation::aligned_alloc<ScalarType>(64,num*sizeof(ScalarType));\
@@ -170,7 +178,8 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   /*--- Preconditioners. ---*/
 
   if (ilu_needed) {
-    ALLOC_AND_INIT(ILU_matrix, nnz_ilu*nVar*nEqn)
+    if (ilu_in_place) ILU_matrix = matrix;
+    else ALLOC_AND_INIT(ILU_matrix, nnz_ilu*nVar*nEqn)
   }
 
   if (diag_needed) {
@@ -199,6 +208,9 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     omp_partitions[part] = part * pts_per_part;
   omp_partitions[omp_num_parts] = nPointDomain;
 
+  /*--- Alternatively, levels of independent rows for the ILU. ---*/
+  if (ilu_needed && config->GetLinear_Solver_ILU_Levels()) BuildILULevels();
+
   /*--- Generate MKL Kernels ---*/
 
 #ifdef USE_MKL
@@ -226,6 +238,17 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
 }
 
+template<class ScalarType>
+unsigned long CSysMatrix<ScalarType>::GetMemoryFootprint() const {
+
+  unsigned long numEntries = nnz*nVar*nEqn;
+
+  if ((ILU_matrix != nullptr) && !ilu_in_place) numEntries += nnz_ilu*nVar*nEqn;
+  if (invM != nullptr) numEntries += nPointDomain*nVar*nEqn;
+
+  return numEntries*sizeof(ScalarType);
+}
+
 template<class ScalarType>
 template<class OtherType>
 void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
@@ -731,10 +754,12 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
   /*--- Copy block matrix to compute factorization in-place. ---*/
 
   if ((ilu_fill_in == 0) && !transposed) {
-    /*--- ILU0, direct copy. ---*/
-    SU2_OMP_FOR_STAT(omp_light_size)
-    for (auto iVar = 0ul; iVar < nnz*nVar*nVar; ++iVar)
-      ILU_matrix[iVar] = matrix[iVar];
+    /*--- ILU0, direct copy, unless the matrix itself is factorized. ---*/
+    if (!ilu_in_place) {
+      SU2_OMP_FOR_STAT(omp_light_size)
+      for (auto iVar = 0ul; iVar < nnz*nVar*nVar; ++iVar)
+        ILU_matrix[iVar] = matrix[iVar];
+    }
   }
   else {
     /*--- ILUn clear the ILU matrix first, for ILU0^T
@@ -762,6 +787,22 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  if (!ilu_lower_rows.empty()) {
+
+    /*--- Level scheduling, the rows of a level are factorized in parallel, the implicit barrier
+     *    at the end of each loop ensures the rows of the next level have their dependencies. ---*/
+
+    for (auto level = 0ul; level+1 < ilu_lower_level_ptr.size(); ++level) {
+      const auto begin = ilu_lower_level_ptr[level];
+      const auto end = ilu_lower_level_ptr[level+1];
+
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(end-begin, omp_get_num_threads(), OMP_MAX_SIZE_H))
+      for (auto k = begin; k < end; ++k)
+        FactorizeRow_ILUMatrix(ilu_lower_rows[k], 0, nPointDomain);
+    }
+    return;
+  }
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -776,63 +817,49 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
      *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
      *    what the MPI-only implementation does. ---*/
 
-    ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
-
-    for (auto iPoint = begin+1; iPoint < end; iPoint++) {
-
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
-
-      InverseDiagonalBlock_ILUMatrix(iPoint-1, &invM[(iPoint-1)*nVar*nVar]);
-
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
-
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
-
-        auto jPoint = col_ind_ilu[index];
-
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
-
-        if (jPoint < begin) continue;
-
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
-
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
-
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
-
-        for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
-
-          /*--- Get the column index (kPoint > jPoint). ---*/
+    for (auto iPoint = begin; iPoint < end; iPoint++)
+      FactorizeRow_ILUMatrix(iPoint, begin, end);
+  }
 
-          auto kPoint = col_ind_ilu[index_];
+}
 
-          if (kPoint >= end) break;
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildILULevels() {
 
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+  /*--- The level of a row is one more than the highest level of the rows it depends on, i.e. the
+   *    columns below the diagonal for the factorization and forward sweep, and above it for the
+   *    backward sweep. Halo columns are not considered, as in the partitioned implementation. ---*/
 
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+  auto buildLevels = [this](bool lower, vector<unsigned long>& level_ptr, vector<unsigned long>& rows) {
 
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_*nVar*nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
+    vector<unsigned long> level(nPointDomain, 0);
+    unsigned long nLevel = 0;
 
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+    for (auto k = 0ul; k < nPointDomain; ++k) {
+      const auto iPoint = lower? k : nPointDomain-1-k;
+      const auto begin = lower? row_ptr_ilu[iPoint] : dia_ptr_ilu[iPoint]+1;
+      const auto end = lower? dia_ptr_ilu[iPoint] : row_ptr_ilu[iPoint+1];
 
-        for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
-          Block_ij[iVar] = weight[iVar];
+      for (auto index = begin; index < end; ++index) {
+        const auto jPoint = col_ind_ilu[index];
+        if (jPoint < nPointDomain) level[iPoint] = max(level[iPoint], level[jPoint]+1);
       }
+      nLevel = max(nLevel, level[iPoint]+1);
     }
-    InverseDiagonalBlock_ILUMatrix(end-1, &invM[(end-1)*nVar*nVar]);
 
-  }
+    /*--- Sort the rows by level, with a row_ptr-like structure for the start of each level. ---*/
+
+    level_ptr.assign(nLevel+1, 0);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) ++level_ptr[level[iPoint]+1];
+    for (auto iLevel = 0ul; iLevel < nLevel; ++iLevel) level_ptr[iLevel+1] += level_ptr[iLevel];
+
+    auto pos = level_ptr;
+    rows.resize(nPointDomain);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) rows[pos[level[iPoint]]++] = iPoint;
+  };
 
+  buildLevels(true, ilu_lower_level_ptr, ilu_lower_rows);
+  buildLevels(false, ilu_upper_level_ptr, ilu_upper_rows);
 }
 
 template<class ScalarType>
@@ -841,48 +868,50 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
-  {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread+1];
+  if (!ilu_lower_rows.empty()) {
 
-    ScalarType aux_vec[MAXNVAR];
+    /*--- Level scheduling, forward and backward sweeps over the levels of independent rows. ---*/
 
-    /*--- Copy vector to then work on prod in place ---*/
+    for (auto level = 0ul; level+1 < ilu_lower_level_ptr.size(); ++level) {
+      const auto begin = ilu_lower_level_ptr[level];
+      const auto end = ilu_lower_level_ptr[level+1];
 
-    for (auto iVar = begin*nVar; iVar < end*nVar; iVar++)
-      prod[iVar] = vec[iVar];
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(end-begin, omp_get_num_threads(), OMP_MAX_SIZE_H))
+      for (auto k = begin; k < end; ++k)
+        ForwardRow_ILUMatrix(vec, prod, ilu_lower_rows[k], 0);
+    }
 
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+    for (auto level = 0ul; level+1 < ilu_upper_level_ptr.size(); ++level) {
+      const auto begin = ilu_upper_level_ptr[level];
+      const auto end = ilu_upper_level_ptr[level+1];
 
-    for (auto iPoint = begin+1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
-      }
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(end-begin, omp_get_num_threads(), OMP_MAX_SIZE_H))
+      for (auto k = begin; k < end; ++k)
+        BackwardRow_ILUMatrix(prod, ilu_upper_rows[k], nPointDomain);
     }
+  }
+  else {
 
-    /*--- Backwards substitution (starts at the last row) ---*/
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
+    {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread+1];
 
-    for (auto iPoint = end; iPoint > begin;) {
-      iPoint--; // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        aux_vec[iVar] = prod[iPoint*nVar+iVar];
+      /*--- Forward solve the system using the lower matrix entries that
+       were computed and stored during the ILU preprocessing. Note
+       that we are overwriting the residual vector as we go. ---*/
 
-      for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
-      }
+      for (auto iPoint = begin; iPoint < end; iPoint++)
+        ForwardRow_ILUMatrix(vec, prod, iPoint, begin);
+
+      /*--- Backwards substitution (starts at the last row) ---*/
 
-      MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--; // unsigned type
+        BackwardRow_ILUMatrix(prod, iPoint, end);
+      }
     }
   }
 
@@ -1115,16 +1144,111 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
   SU2_MPI::Allreduce(&Local_nPoints, &Global_nPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
   SU2_MPI::Allreduce(&Local_nLineLets, &Global_nLineLets, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 
+  /*--- Sort the linelets by decreasing length and group them in batches of LINELET_BATCH, the
+   *    last batch is padded with invalid linelets (nLinelet). Similar lengths in a batch
+   *    minimize the work done on padding, the length of a batch is that of its first linelet. ---*/
+
+  const auto nBatch = roundUpDiv(nLinelet, LINELET_BATCH);
+
+  LineletOrder.resize(nBatch*LINELET_BATCH);
+  for (iLinelet = 0; iLinelet < LineletOrder.size(); iLinelet++)
+    LineletOrder[iLinelet] = iLinelet;
+
+  stable_sort(LineletOrder.begin(), LineletOrder.begin()+nLinelet,
+    [this](unsigned long a, unsigned long b) { return LineletPoint[a].size() > LineletPoint[b].size(); });
+
+  LineletBatchPtr.resize(nBatch+1);
+  LineletBatchPtr[0] = 0;
+  for (auto iBatch = 0ul; iBatch < nBatch; iBatch++)
+    LineletBatchPtr[iBatch+1] = LineletBatchPtr[iBatch] + LineletPoint[LineletOrder[iBatch*LINELET_BATCH]].size();
+
   /*--- Memory allocation --*/
 
-  LineletUpper.resize(omp_get_max_threads(), vector<const ScalarType*>(max_nElem,nullptr));
-  LineletVector.resize(omp_get_max_threads(), vector<ScalarType>(max_nElem*nVar,0.0));
-  LineletInvDiag.resize(omp_get_max_threads(), vector<ScalarType>(max_nElem*nVar*nVar,0.0));
+  const auto nBlk = LineletBatchPtr[nBatch] * nVar * nVar * LINELET_BATCH;
+
+  LineletInvDiag.clear(); LineletInvDiag.resize(nBlk, 0.0);
+  LineletLower.clear(); LineletLower.resize(nBlk, 0.0);
+  LineletUpper.clear(); LineletUpper.resize(nBlk, 0.0);
+
+  LineletVector.clear();
+  LineletVector.resize(omp_get_max_threads(), vector<ScalarType>(max_nElem*nVar*LINELET_BATCH,0.0));
 
   return (unsigned long)(passivedouble(Global_nPoints) / Global_nLineLets);
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildLineletFactorization() {
+
+  /*--- Thomas algorithm for the block-tridiagonal system of each linelet, the point "i" of a linelet
+   *    is coupled with "i-1" by the lower block L_i and with "i+1" by the upper block U_i.
+   *    Forward elimination:  W_i = L_i inv(D'_{i-1}),  D'_i = D_i - W_i U_{i-1},  D'_0 = D_0.
+   *    The weights (W), the inverse of the modified diagonal (D') and U are stored, the padding
+   *    of each batch (shorter and invalid linelets) is set to the identity (W = U = 0). ---*/
+
+  const auto nBatch = LineletBatchPtr.empty()? 0ul : LineletBatchPtr.size()-1;
+  const auto K = static_cast<unsigned long>(LINELET_BATCH);
+  const auto nVar2 = nVar*nVar;
+
+  SU2_OMP_FOR_DYN(1)
+  for (auto iBatch = 0ul; iBatch < nBatch; iBatch++) {
+
+    const auto ptr = LineletBatchPtr[iBatch];
+    const auto nElemBatch = LineletBatchPtr[iBatch+1] - ptr;
+
+    for (auto iLane = 0ul; iLane < K; iLane++) {
+
+      const auto iLinelet = LineletOrder[iBatch*K+iLane];
+      const auto nElem = (iLinelet < nLinelet)? LineletPoint[iLinelet].size() : 0ul;
+
+      /*--- Scatter a block into the interleaved storage. ---*/
+      auto store = [&](const ScalarType* block, unsigned long iElem, vector<ScalarType>& dst) {
+        for (auto k = 0ul; k < nVar2; k++)
+          dst[((ptr+iElem)*nVar2 + k)*K + iLane] = block ? block[k] : ScalarType(0.0);
+      };
+
+      ScalarType d_prime[MAXNVAR*MAXNVAR], inv_dm1[MAXNVAR*MAXNVAR], weight[MAXNVAR*MAXNVAR];
+
+      for (auto iElem = 0ul; iElem < nElem; iElem++) {
+
+        const auto iPoint = LineletPoint[iLinelet][iElem];
+
+        MatrixCopy(&matrix[dia_ptr[iPoint]*nVar2], d_prime);
+
+        if (iElem > 0) {
+          const auto im1Point = LineletPoint[iLinelet][iElem-1];
+
+          /*--- Weight, and modification of the diagonal. ---*/
+          MatrixMatrixProduct(GetBlock(iPoint, im1Point), inv_dm1, weight);
+          ScalarType aux_block[MAXNVAR*MAXNVAR];
+          MatrixMatrixProduct(weight, GetBlock(im1Point, iPoint), aux_block);
+          MatrixSubtraction(d_prime, aux_block, d_prime);
+
+          store(weight, iElem, LineletLower);
+        }
+        else {
+          store(nullptr, iElem, LineletLower);
+        }
+
+        store((iElem+1 < nElem)? GetBlock(iPoint, LineletPoint[iLinelet][iElem+1]) : nullptr, iElem, LineletUpper);
+
+        /*--- The inverse of this modified diagonal is needed by the next point (d_prime is destroyed). ---*/
+        MatrixInverse(d_prime, inv_dm1);
+        store(inv_dm1, iElem, LineletInvDiag);
+      }
+
+      /*--- Padding. ---*/
+      for (auto iElem = nElem; iElem < nElemBatch; iElem++) {
+        store(nullptr, iElem, LineletLower);
+        store(nullptr, iElem, LineletUpper);
+        for (auto k = 0ul; k < nVar2; k++)
+          LineletInvDiag[((ptr+iElem)*nVar2 + k)*K + iLane] = ScalarType((k%(nVar+1) == 0)? 1.0 : 0.0);
+      }
+    }
+  }
+
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                           CGeometry *geometry, const CConfig *config) const {
@@ -1138,89 +1262,98 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
     if (!LineletBool[iPoint])
       MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
 
-  /*--- Solve each linelet using the Thomas algorithm ---*/
+  /*--- Solve the linelets of each batch simultaneously with the factorization from BuildLineletFactorization,
+   *    the innermost loops are over the linelets of the batch (contiguous in memory) to vectorize. ---*/
+
+  const auto nBatch = LineletBatchPtr.empty()? 0ul : LineletBatchPtr.size()-1;
+  const auto K = static_cast<unsigned long>(LINELET_BATCH);
+  const auto nVar2 = nVar*nVar;
 
   SU2_OMP_FOR_DYN(1)
-  for (auto iLinelet = 0ul; iLinelet < nLinelet; iLinelet++) {
+  for (auto iBatch = 0ul; iBatch < nBatch; iBatch++) {
 
-    /*--- Get references to the working vectors allocated for this thread. ---*/
+    const auto ptr = LineletBatchPtr[iBatch];
+    const auto nElem = LineletBatchPtr[iBatch+1] - ptr;
 
-    int thread = omp_get_thread_num();
-    vector<const ScalarType*>& lineletUpper = LineletUpper[thread];
-    vector<ScalarType>& lineletInvDiag = LineletInvDiag[thread];
-    vector<ScalarType>& lineletVector = LineletVector[thread];
+    /*--- Working vector allocated for this thread, layout (point, variable, linelet). ---*/
 
-    /*--- Initialize the solution vector with the rhs ---*/
+    ScalarType* x = LineletVector[omp_get_thread_num()].data();
 
-    auto nElem = LineletPoint[iLinelet].size();
+    /*--- Initialize the solution vector with the rhs (0 in the padding). ---*/
 
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      auto iPoint = LineletPoint[iLinelet][iElem];
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        lineletVector[iElem*nVar+iVar] = vec[iPoint*nVar+iVar];
-    }
+    for (auto iLane = 0ul; iLane < K; iLane++) {
+      const auto iLinelet = LineletOrder[iBatch*K+iLane];
+      const auto nElemLine = (iLinelet < nLinelet)? LineletPoint[iLinelet].size() : 0ul;
 
-    /*--- Forward pass, eliminate lower entries, modify diagonal and rhs. ---*/
-
-    /*--- Small temporaries. ---*/
-    ScalarType aux_block[MAXNVAR*MAXNVAR], aux_vector[MAXNVAR];
+      for (auto iElem = 0ul; iElem < nElem; iElem++) {
+        for (auto iVar = 0ul; iVar < nVar; iVar++) {
+          x[(iElem*nVar+iVar)*K + iLane] = (iElem < nElemLine)?
+            vec[LineletPoint[iLinelet][iElem]*nVar+iVar] : ScalarType(0.0);
+        }
+      }
+    }
 
-    /*--- Copy diagonal block for first point in this linelet. ---*/
-    MatrixCopy(&matrix[dia_ptr[LineletPoint[iLinelet][0]]*nVar*nVar],
-               lineletInvDiag.data());
+    /*--- Forward pass, b_i -= W_i b_{i-1}. ---*/
 
     for (auto iElem = 1ul; iElem < nElem; iElem++) {
+      const ScalarType* w = &LineletLower[(ptr+iElem)*nVar2*K];
+      const ScalarType* bm1 = &x[(iElem-1)*nVar*K];
+      ScalarType* b = &x[iElem*nVar*K];
 
-      /*--- Setup pointers to required matrices and vectors ---*/
-      auto im1Point = LineletPoint[iLinelet][iElem-1];
-      auto iPoint = LineletPoint[iLinelet][iElem];
-
-      auto d = &matrix[dia_ptr[iPoint]*nVar*nVar];
-      auto l = GetBlock(iPoint, im1Point);
-      auto u = GetBlock(im1Point, iPoint);
-
-      auto inv_dm1 = &lineletInvDiag[(iElem-1)*nVar*nVar];
-      auto d_prime = &lineletInvDiag[iElem*nVar*nVar];
-      auto b_prime = &lineletVector[iElem*nVar];
-
-      /*--- Invert previous modified diagonal ---*/
-      MatrixCopy(inv_dm1, aux_block);
-      MatrixInverse(aux_block, inv_dm1);
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        for (auto jVar = 0ul; jVar < nVar; jVar++)
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (auto iLane = 0ul; iLane < K; iLane++)
+            b[iVar*K+iLane] -= w[(iVar*nVar+jVar)*K+iLane] * bm1[jVar*K+iLane];
+    }
 
-      /*--- Left-multiply by lower block to obtain the weight ---*/
-      MatrixMatrixProduct(l, inv_dm1, aux_block);
+    /*--- Backward substitution, x_i = inv(D'_i) (b_i - U_i x_{i+1}), x becomes the solution. ---*/
 
-      /*--- Multiply weight by upper block to modify current diagonal ---*/
-      MatrixMatrixProduct(aux_block, u, d_prime);
-      MatrixSubtraction(d, d_prime, d_prime);
+    for (auto iElem = nElem; iElem > 0; --iElem) {
+      const auto i = iElem-1;
+      const ScalarType* invd = &LineletInvDiag[(ptr+i)*nVar2*K];
+      const ScalarType* u = &LineletUpper[(ptr+i)*nVar2*K];
+      ScalarType* b = &x[i*nVar*K];
 
-      /*--- Update the rhs ---*/
-      MatrixVectorProduct(aux_block, &lineletVector[(iElem-1)*nVar], aux_vector);
-      VectorSubtraction(b_prime, aux_vector, b_prime);
+      ScalarType aux[MAXNVAR*LINELET_BATCH];
 
-      /*--- Cache upper block pointer for the backward substitution phase ---*/
-      lineletUpper[iElem-1] = u;
-    }
+      for (auto iVar = 0ul; iVar < nVar; iVar++) {
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (auto iLane = 0ul; iLane < K; iLane++)
+          aux[iVar*K+iLane] = b[iVar*K+iLane];
 
-    /*--- Backwards substitution, LineletVector becomes the solution ---*/
+        if (i+1 < nElem) {
+          const ScalarType* xp1 = &x[(i+1)*nVar*K];
+          for (auto jVar = 0ul; jVar < nVar; jVar++)
+            SU2_OMP_SIMD_IF_NOT_AD
+            for (auto iLane = 0ul; iLane < K; iLane++)
+              aux[iVar*K+iLane] -= u[(iVar*nVar+jVar)*K+iLane] * xp1[jVar*K+iLane];
+        }
+      }
 
-    /*--- x_n = d_n^{-1} * b_n ---*/
-    Gauss_Elimination(&lineletInvDiag[(nElem-1)*nVar*nVar], &lineletVector[(nElem-1)*nVar]);
+      for (auto iVar = 0ul; iVar < nVar; iVar++) {
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (auto iLane = 0ul; iLane < K; iLane++)
+          b[iVar*K+iLane] = 0.0;
 
-    /*--- x_i = d_i^{-1}*(b_i - u_i*x_{i+1}) ---*/
-    for (auto iElem = nElem-1; iElem > 0; --iElem) {
-      auto inv_dm1 = &lineletInvDiag[(iElem-1)*nVar*nVar];
-      MatrixVectorProduct(lineletUpper[iElem-1], &lineletVector[iElem*nVar], aux_vector);
-      VectorSubtraction(&lineletVector[(iElem-1)*nVar], aux_vector, aux_vector);
-      MatrixVectorProduct(inv_dm1, aux_vector, &lineletVector[(iElem-1)*nVar]);
+        for (auto jVar = 0ul; jVar < nVar; jVar++)
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (auto iLane = 0ul; iLane < K; iLane++)
+            b[iVar*K+iLane] += invd[(iVar*nVar+jVar)*K+iLane] * aux[jVar*K+iLane];
+      }
     }
 
     /*--- Copy results to product vector ---*/
 
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      auto iPoint = LineletPoint[iLinelet][iElem];
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        prod[iPoint*nVar+iVar] = lineletVector[iElem*nVar+iVar];
+    for (auto iLane = 0ul; iLane < K; iLane++) {
+      const auto iLinelet = LineletOrder[iBatch*K+iLane];
+      if (iLinelet >= nLinelet) continue;
+
+      for (auto iElem = 0ul; iElem < LineletPoint[iLinelet].size(); iElem++) {
+        const auto iPoint = LineletPoint[iLinelet][iElem];
+        for (auto iVar = 0ul; iVar < nVar; iVar++)
+          prod[iPoint*nVar+iVar] = x[(iElem*nVar+iVar)*K + iLane];
+      }
     }
 
   }
@@ -46,6 +46,26 @@ namespace {
   constexpr T linSolEpsilon() { return numeric_limits<passivedouble>::epsilon(); }
   template<>
   constexpr float linSolEpsilon<float>() { return 1e-12; }
+
+  /*--- The reductions of the fused dot products are non-blocking when the MPI wrapper of the
+   *    type is the passive one, otherwise (AD types) the usual blocking reduction is used. ---*/
+  template<class T>
+  using NonBlockingReduction = std::is_same<typename SelectMPIWrapper<T>::W, CBaseMPIWrapper>;
+
+  template<class T>
+  void StartSumReduction(T* local, T* global, int n, CBaseMPIWrapper::Request& request, std::true_type) {
+    const auto mpi_type = (sizeof(T) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+    CBaseMPIWrapper::Iallreduce(local, global, n, mpi_type, MPI_SUM, MPI_COMM_WORLD, &request);
+  }
+  template<class T>
+  void StartSumReduction(T* local, T* global, int n, CBaseMPIWrapper::Request&, std::false_type) {
+    const auto mpi_type = (sizeof(T) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+    SelectMPIWrapper<T>::W::Allreduce(local, global, n, mpi_type, MPI_SUM, MPI_COMM_WORLD);
+  }
+  inline void FinishSumReduction(CBaseMPIWrapper::Request& request, std::true_type) {
+    CBaseMPIWrapper::Wait(&request, MPI_STATUS_IGNORE);
+  }
+  inline void FinishSumReduction(CBaseMPIWrapper::Request&, std::false_type) {}
 }
 
 template<class ScalarType>
@@ -168,6 +188,88 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
 
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::StartDotProducts(const vector<const VectorType*>& a,
+                                             const vector<const VectorType*>& b) const {
+  const auto n = a.size();
+  const auto nElmDomain = a[0]->GetNElmDomain();
+
+  /*--- Each thread accumulates in its own padded slice of dots_thread (no false sharing). ---*/
+  const auto stride = nextMultiple(n, 8);
+
+  /*--- All threads get the same "view" of the vectors and shared results. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+    if (dots_local.size() < n) {
+      dots_local.resize(n);
+      dots_global.resize(n);
+    }
+    const auto sizeThreads = stride * omp_get_num_threads();
+    if (dots_thread.size() < sizeThreads) dots_thread.resize(sizeThreads);
+    for (auto k = 0ul; k < n; ++k) dots_local[k] = 0.0;
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Local dot products for each thread, one pass over the vectors. ---*/
+  ScalarType* sum = &dots_thread[stride * omp_get_thread_num()];
+  for (auto k = 0ul; k < n; ++k) sum[k] = 0.0;
+
+  const size_t chunk = computeStaticChunkSize(nElmDomain, omp_get_num_threads(), 4096);
+
+  SU2_OMP(for schedule(static,chunk) nowait)
+  for (auto i = 0ul; i < nElmDomain; ++i)
+    for (auto k = 0ul; k < n; ++k)
+      sum[k] += (*a[k])[i] * (*b[k])[i];
+
+  SU2_OMP_CRITICAL
+  for (auto k = 0ul; k < n; ++k) dots_local[k] += sum[k];
+  SU2_OMP_BARRIER
+
+  /*--- Start the reduction across ranks, only the master thread communicates and the other
+   *    threads can continue. The nElm condition is to allow vectors to also be used locally. ---*/
+  SU2_OMP_MASTER {
+    bool reduce = false;
+#ifdef HAVE_MPI
+    reduce = (a[0]->GetLocSize() != nElmDomain);
+#endif
+    if (reduce) {
+      StartSumReduction(dots_local.data(), dots_global.data(), n, dots_request, NonBlockingReduction<ScalarType>());
+      dots_pending = true;
+    }
+    else {
+      for (auto k = 0ul; k < n; ++k) dots_global[k] = dots_local[k];
+    }
+  }
+}
+
+template<class ScalarType>
+const ScalarType* CSysSolve<ScalarType>::FinishDotProducts() const {
+
+  SU2_OMP_MASTER
+  if (dots_pending) {
+    FinishSumReduction(dots_request, NonBlockingReduction<ScalarType>());
+    dots_pending = false;
+  }
+  SU2_OMP_BARRIER
+
+  return dots_global.data();
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::AllocatePipelined(unsigned long n, const VectorType& x) const {
+
+  if (pipe_vec.size() >= n) return;
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+    const auto n0 = pipe_vec.size();
+    pipe_vec.resize(n);
+    for (auto k = n0; k < n; ++k)
+      pipe_vec[k].Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+  }
+  SU2_OMP_BARRIER
+}
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(string solver, ScalarType restol, ScalarType resinit) const {
 
@@ -650,6 +752,756 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   return i;
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PipelinedCG_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                           const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                           ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the notation follows Ghysels and Vanroose, "Hiding global
+   *    synchronization latency in the preconditioned Conjugate Gradient algorithm". ---*/
+
+  AllocatePipelined(9, x);
+
+  auto& r_i = pipe_vec[0]; auto& u_i = pipe_vec[1]; auto& w_i = pipe_vec[2];
+  auto& m_i = pipe_vec[3]; auto& n_i = pipe_vec[4]; auto& z_i = pipe_vec[5];
+  auto& q_i = pipe_vec[6]; auto& s_i = pipe_vec[7]; auto& p_i = pipe_vec[8];
+
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+
+  mat_vec(x, n_i);
+  r_i = b - n_i;
+
+  norm_r = r_i.norm();
+  norm0  = b.norm();
+  if ((norm_r < tol*norm0) || (norm_r < eps)) {
+    if (master && !mesh_deform) cout << "CSysSolve::PipelinedCG(): system solved by initial guess." << endl;
+    return 0;
+  }
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  if (tol_type == LinearToleranceType::RELATIVE)
+    norm0 = norm_r;
+
+  /*--- Output header information including initial residual ---*/
+
+  if ((monitoring) && (master)) {
+    WriteHeader("Pipelined CG", tol, norm_r);
+    WriteHistory(i, norm_r/norm0);
+  }
+
+  /*--- Initialization, u = M r, w = A u ---*/
+
+  precond(r_i, u_i);
+  mat_vec(u_i, w_i);
+
+  ScalarType alpha = 0.0, gamma_prev = 0.0;
+
+  /*--- Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*--- Start the (single) reduction of gamma = (r,u), delta = (w,u), and of the residual norm. ---*/
+
+    StartDotProducts({&r_i, &w_i, &r_i}, {&u_i, &u_i, &r_i});
+
+    /*--- Meanwhile, m = M w and n = A m. ---*/
+
+    precond(w_i, m_i);
+    mat_vec(m_i, n_i);
+
+    const ScalarType* dots = FinishDotProducts();
+    const ScalarType gamma = dots[0], delta = dots[1];
+    norm_r = sqrt(dots[2]);
+
+    /*--- Check if solution has converged (the residual lags one iteration behind the
+     *    solution update), else output the relative residual if necessary. ---*/
+
+    if (i > 0) {
+      if (norm_r < tol*norm0) break;
+      if (((monitoring) && (master)) && (i % 10 == 0))
+        WriteHistory(i, norm_r/norm0);
+    }
+
+    /*--- Step lengths and search directions, the recurrences avoid the other products. ---*/
+
+    if (i == 0) {
+      alpha = gamma / delta;
+      z_i = n_i; q_i = m_i; s_i = w_i; p_i = u_i;
+    }
+    else {
+      const ScalarType beta = gamma / gamma_prev;
+      alpha = gamma / (delta - beta*gamma/alpha);
+      z_i = n_i + beta*z_i;
+      q_i = m_i + beta*q_i;
+      s_i = w_i + beta*s_i;
+      p_i = u_i + beta*p_i;
+    }
+    gamma_prev = gamma;
+
+    /*--- Update solution, residual, preconditioned residual, and its product. ---*/
+
+    x += alpha * p_i;
+    r_i -= alpha * s_i;
+    u_i -= alpha * q_i;
+    w_i -= alpha * z_i;
+  }
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("Pipelined CG", i, norm_r/norm0);
+
+    mat_vec(x, n_i);
+    r_i = b - n_i;
+    ScalarType true_res = r_i.norm();
+
+    if (fabs(true_res - norm_r) > tol*10.0) {
+      if (master) {
+        WriteWarning(norm_r, true_res, tol);
+      }
+    }
+
+  }
+
+  residual = norm_r/norm0;
+  return i;
+}
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PipelinedGMRES_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                              const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                              ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("GMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the basis (W) and preconditioned basis (Z) are shared
+   *    with FGMRES, the products of the latter with the matrix (AZ) are also needed. ---*/
+
+  if (!gmres_ready || AZ.empty()) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      if (!gmres_ready) {
+        W.resize(m+1);
+        Z.resize(m+1);
+        for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        gmres_ready = true;
+      }
+      AZ.resize(W.size());
+      for (auto& az : AZ) az.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+    }
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Define various arrays (see FGMRES). ---*/
+
+  su2vector<ScalarType> g(m+1), sn(m+1), cs(m+1), y(m);
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m+1, m);
+  H = ScalarType(0);
+
+  /*--- Below this ratio of the squared norms (after the second Gram-Schmidt pass) the norm
+   *    of the new vector is computed explicitly instead of by Pythagoras. ---*/
+
+  const ScalarType cancel_tol = sqrt(numeric_limits<ScalarType>::epsilon());
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual and compute its norm. ---*/
+
+  mat_vec(x, W[0]);
+  W[0] = b - W[0];
+
+  ScalarType beta = W[0].norm();
+
+  if ((beta < tol*norm0) || (beta < eps)) {
+
+    /*--- System is already solved ---*/
+
+    if (master) cout << "CSysSolve::PipelinedGMRES(): system solved by initial guess." << endl;
+    residual = beta;
+    return 0;
+  }
+
+  W[0] /= beta;
+  g[0] = beta;
+
+  /*--- Set the norm to the initial residual value ---*/
+
+  if (tol_type == LinearToleranceType::RELATIVE)
+    norm0 = beta;
+
+  /*--- Output header information including initial residual ---*/
+
+  unsigned long i = 0;
+  if ((monitoring) && (master)) {
+    WriteHeader("Pipelined GMRES", tol, beta);
+    WriteHistory(i, beta/norm0);
+  }
+
+  /*--- The preconditioned basis vector and its product are computed one step ahead. ---*/
+
+  precond(W[0], Z[0]);
+  mat_vec(Z[0], AZ[0]);
+
+  vector<const VectorType*> dot_a, dot_b;
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*---  Check if solution has converged ---*/
+
+    if (beta < tol*norm0) break;
+
+    /*--- Start the (single) reduction of the projections of AZ[i] on the basis. ---*/
+
+    dot_a.assign(i+1, &AZ[i]);
+    dot_b.clear();
+    for (unsigned long k = 0; k <= i; k++) dot_b.push_back(&W[k]);
+
+    StartDotProducts(dot_a, dot_b);
+
+    /*--- Meanwhile, precondition and multiply the next (not yet orthogonal) vector. ---*/
+
+    precond(AZ[i], Z[i+1]);
+    mat_vec(Z[i+1], AZ[i+1]);
+
+    const ScalarType* dots = FinishDotProducts();
+
+    for (unsigned long k = 0; k <= i; k++) H[k][i] = dots[k];
+
+    /*--- Classical Gram-Schmidt, the same combination is applied to Z and AZ. ---*/
+
+    W[i+1] = AZ[i];
+    for (unsigned long k = 0; k <= i; k++) {
+      W[i+1] -= H[k][i] * W[k];
+      Z[i+1] -= H[k][i] * Z[k];
+      AZ[i+1] -= H[k][i] * AZ[k];
+    }
+
+    /*--- A single classical pass loses orthogonality and the method stagnates, a second pass
+     *    restores it ("twice is enough"). Its fused reduction, which also gives the norm, is
+     *    blocking, i.e. two reductions per iteration instead of the i+2 of FGMRES. ---*/
+
+    dot_a.assign(i+2, &W[i+1]);
+    dot_b.push_back(&W[i+1]);
+
+    StartDotProducts(dot_a, dot_b);
+    dots = FinishDotProducts();
+
+    const ScalarType nu = dots[i+1];
+    ScalarType nrm2 = nu;
+    for (unsigned long k = 0; k <= i; k++) {
+      H[k][i] += dots[k];
+      nrm2 -= pow(dots[k], 2);
+      W[i+1] -= dots[k] * W[k];
+      Z[i+1] -= dots[k] * Z[k];
+      AZ[i+1] -= dots[k] * AZ[k];
+    }
+
+    const ScalarType nrm = (nrm2 > cancel_tol*nu)? sqrt(nrm2) : W[i+1].norm();
+
+    if ((nrm <= 0.0) || (nrm != nrm)) {
+      SU2_OMP_MASTER
+      SU2_MPI::Error("Pipelined GMRES orthogonalization has failed, linear solver diverged.", CURRENT_FUNCTION);
+    }
+
+    H[i+1][i] = nrm;
+    W[i+1] /= nrm;
+    Z[i+1] /= nrm;
+    AZ[i+1] /= nrm;
+
+    /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+     new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+    for (unsigned long k = 0; k < i; k++)
+      ApplyGivens(sn[k], cs[k], H[k][i], H[k+1][i]);
+    GenerateGivens(H[i][i], H[i+1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i+1]);
+
+    /*---  Set L2 norm of residual and check if solution has converged ---*/
+
+    beta = fabs(g[i+1]);
+
+    /*---  Output the relative residual if necessary ---*/
+
+    if (((monitoring) && (master)) && ((i+1) % 10 == 0))
+      WriteHistory(i+1, beta/norm0);
+  }
+
+  /*---  Solve the least-squares system and update solution ---*/
+
+  SolveReduced(i, H, g, y);
+  for (unsigned long k = 0; k < i; k++) {
+    x += y[k] * Z[k];
+  }
+
+  /*---  Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("Pipelined GMRES", i, beta/norm0);
+
+    mat_vec(x, W[0]);
+    W[0] -= b;
+    ScalarType res = W[0].norm();
+
+    if (fabs(res - beta) > tol*10) {
+      if (master) {
+        WriteWarning(beta, res, tol);
+      }
+    }
+
+  }
+
+  residual = beta/norm0;
+  return i;
+
+}
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PipelinedBCGSTAB_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                                const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                                ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the notation follows Cools and Vanroose, "The communication-hiding
+   *    pipelined BiCGStab method for the parallel solution of large unsymmetric linear systems". ---*/
+
+  AllocatePipelined(12, x);
+
+  auto& r_hat = pipe_vec[0]; auto& r_i = pipe_vec[1]; auto& w_i = pipe_vec[2];
+  auto& t_i = pipe_vec[3]; auto& p_i = pipe_vec[4]; auto& s_i = pipe_vec[5];
+  auto& z_i = pipe_vec[6]; auto& q_i = pipe_vec[7]; auto& y_i = pipe_vec[8];
+  auto& v_i = pipe_vec[9]; auto& u_i = pipe_vec[10]; auto& tmp = pipe_vec[11];
+
+  /*--- Right preconditioning, the operator is A M and the solution x0 + M u. ---*/
+
+  auto prec_mat_vec = [&](const VectorType& in, VectorType& out) {
+    precond(in, tmp);
+    mat_vec(tmp, out);
+  };
+
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+
+  mat_vec(x, tmp);
+  r_i = b - tmp;
+
+  norm_r = r_i.norm();
+  norm0  = b.norm();
+  if ((norm_r < tol*norm0) || (norm_r < eps)) {
+    if (master) cout << "CSysSolve::PipelinedBCGSTAB(): system solved by initial guess." << endl;
+    return 0;
+  }
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  if (tol_type == LinearToleranceType::RELATIVE)
+    norm0 = norm_r;
+
+  /*--- Output header information including initial residual ---*/
+
+  if ((monitoring) && (master)) {
+    WriteHeader("Pipelined BCGSTAB", tol, norm_r);
+    WriteHistory(i, norm_r/norm0);
+  }
+
+  /*--- Initialization ---*/
+
+  r_hat = r_i;
+  u_i = ScalarType(0.0);
+  prec_mat_vec(r_i, w_i);
+  prec_mat_vec(w_i, t_i);
+
+  StartDotProducts({&r_hat, &r_hat}, {&r_i, &w_i});
+  const ScalarType* dots = FinishDotProducts();
+
+  ScalarType rho = dots[0], alpha = dots[0] / dots[1], beta = 0.0, omega = 0.0;
+
+  /*--- Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*--- Update the search direction and its (recurrence) products. ---*/
+
+    if (i == 0) {
+      p_i = r_i; s_i = w_i; z_i = t_i;
+    }
+    else {
+      p_i = r_i + beta*(p_i - omega*s_i);
+      s_i = w_i + beta*(s_i - omega*z_i);
+      z_i = t_i + beta*(z_i - omega*v_i);
+    }
+    q_i = r_i - alpha*s_i;
+    y_i = w_i - alpha*z_i;
+
+    /*--- First reduction, for omega, overlapped with v = A M z. ---*/
+
+    StartDotProducts({&q_i, &y_i}, {&y_i, &y_i});
+
+    prec_mat_vec(z_i, v_i);
+
+    dots = FinishDotProducts();
+
+    /*--- Calculate step-length omega, avoid division by 0. ---*/
+
+    if (dots[1] == ScalarType(0)) {
+      u_i += alpha * p_i;
+      break;
+    }
+    omega = dots[0] / dots[1];
+
+    /*--- Update solution and residual ---*/
+
+    u_i += alpha*p_i + omega*q_i;
+    r_i = q_i - omega*y_i;
+    w_i = y_i - omega*(t_i - alpha*v_i);
+
+    /*--- Second reduction, for alpha and beta and the residual norm, overlapped with t = A M w. ---*/
+
+    StartDotProducts({&r_hat, &r_hat, &r_hat, &r_hat, &r_i}, {&r_i, &w_i, &s_i, &z_i, &r_i});
+
+    prec_mat_vec(w_i, t_i);
+
+    dots = FinishDotProducts();
+
+    const ScalarType rho_new = dots[0];
+    beta = (alpha / omega) * (rho_new / rho);
+    alpha = rho_new / (dots[1] + beta*dots[2] - beta*omega*dots[3]);
+    rho = rho_new;
+    norm_r = sqrt(dots[4]);
+
+    /*--- Check if solution has converged, else output the relative residual if necessary ---*/
+
+    if (norm_r < tol*norm0) break;
+    if (((monitoring) && (master)) && ((i+1) % 10 == 0))
+      WriteHistory(i+1, norm_r/norm0);
+  }
+
+  /*--- Apply the preconditioner to the accumulated update. ---*/
+
+  precond(u_i, tmp);
+  x += tmp;
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("Pipelined BCGSTAB", i, norm_r/norm0);
+
+    mat_vec(x, tmp);
+    r_i = b - tmp;
+    ScalarType true_res = r_i.norm();
+
+    if ((fabs(true_res - norm_r) > tol*10.0) && (master)) {
+      WriteWarning(norm_r, true_res, tol);
+    }
+
+  }
+
+  residual = norm_r/norm0;
+  return i;
+}
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::RecyclingGCRO_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                             const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                             ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Size of the cycles (inner FGMRES) and max size of the recycled subspace. ---*/
+
+  const unsigned long s = max<unsigned long>(1, min(config->GetLinear_Solver_Restart_Frequency(), m));
+  const unsigned long k = config->GetLinear_Solver_Recycle_Size();
+
+  if (s > 5000) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("GCRO subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the Arnoldi vectors are shared with FGMRES. The recycled
+   *    subspace has one extra slot for the new direction, and it is reset if the system size changes. ---*/
+
+  if (!gmres_ready || (W.size() < s+1) || (RecU.size() != k+1) || (RecU[0].GetLocSize() != x.GetLocSize())) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      if (!gmres_ready || (W.size() < s+1)) {
+        W.resize(s+1);
+        Z.resize(s+1);
+        for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        gmres_ready = true;
+      }
+      if ((RecU.size() != k+1) || (RecU[0].GetLocSize() != x.GetLocSize())) {
+        RecU.resize(k+1);
+        RecC.resize(k+1);
+        for (auto& u : RecU) u.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        for (auto& c : RecC) c.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        rec_order.clear();
+      }
+    }
+    SU2_OMP_BARRIER
+  }
+
+  /*--- The decisions about the recycled directions are based on dot products, therefore all
+   *    threads take the same decisions, each on its copy of the (shared) list of directions. ---*/
+
+  vector<unsigned long> order = rec_order;
+
+  /*--- Define various arrays (see FGMRES), H is kept before the Givens rotations
+   *    to compute the product of the correction with the matrix, B = C^T A Z. ---*/
+
+  su2vector<ScalarType> g(s+1), sn(s+1), cs(s+1), y(s);
+  su2matrix<ScalarType> H(s+1, s), H0(s+1, s), B(k+1, s);
+
+  const ScalarType cancel_tol = sqrt(numeric_limits<ScalarType>::epsilon());
+
+  /*--- Refresh the recycled subspace for the current matrix, C = A U orthonormalized (MGS), the
+   *    same operations are applied to U to keep the relation. Dependent directions are dropped. ---*/
+
+  for (auto it = order.begin(); it != order.end();) {
+    auto& u_j = RecU[*it];
+    auto& c_j = RecC[*it];
+
+    mat_vec(u_j, c_j);
+    const ScalarType nrm_A = c_j.norm();
+
+    for (auto l = order.begin(); l != it; ++l) {
+      const ScalarType h = RecC[*l].dot(c_j);
+      c_j -= h * RecC[*l];
+      u_j -= h * RecU[*l];
+    }
+    const ScalarType nrm = c_j.norm();
+
+    if ((nrm > 0.0) && (nrm > cancel_tol*nrm_A)) {
+      c_j /= nrm;
+      u_j /= nrm;
+      ++it;
+    }
+    else {
+      it = order.erase(it);
+    }
+  }
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual and compute its norm. ---*/
+
+  mat_vec(x, W[0]);
+  W[0] = b - W[0];
+
+  ScalarType beta = W[0].norm();
+
+  if ((beta < tol*norm0) || (beta < eps)) {
+
+    /*--- System is already solved ---*/
+
+    if (master) cout << "CSysSolve::RecyclingGCRO(): system solved by initial guess." << endl;
+    residual = beta;
+    return 0;
+  }
+
+  /*--- Set the norm to the initial residual value ---*/
+
+  if (tol_type == LinearToleranceType::RELATIVE)
+    norm0 = beta;
+
+  /*--- Output header information including initial residual ---*/
+
+  unsigned long iter = 0;
+  if ((monitoring) && (master)) {
+    WriteHeader("GCRO", tol, beta);
+    WriteHistory(iter, beta/norm0);
+  }
+
+  /*--- Improve the initial guess with the recycled subspace, x += U C^T r, r -= C C^T r. ---*/
+
+  for (auto j : order) {
+    const ScalarType h = RecC[j].dot(W[0]);
+    x += h * RecU[j];
+    W[0] -= h * RecC[j];
+  }
+  if (!order.empty()) beta = W[0].norm();
+
+  /*--- Restart cycles, each is an FGMRES for the operator (I - C C^T) A. ---*/
+
+  while ((iter < m) && (beta >= tol*norm0)) {
+
+    const auto nRec = order.size();
+    const auto sCycle = min(s, m-iter);
+    const ScalarType betaCycle = beta;
+
+    g = ScalarType(0); sn = ScalarType(0); cs = ScalarType(0); y = ScalarType(0);
+    H = ScalarType(0); H0 = ScalarType(0); B = ScalarType(0);
+
+    W[0] /= beta;
+    g[0] = beta;
+
+    unsigned long i = 0;
+    while (i < sCycle) {
+
+      /*--- Precondition, add to Krylov subspace, and keep it orthogonal to the recycled one. ---*/
+
+      precond(W[i], Z[i]);
+      mat_vec(Z[i], W[i+1]);
+
+      for (auto l = 0ul; l < nRec; l++) {
+        B(l,i) = RecC[order[l]].dot(W[i+1]);
+        W[i+1] -= B(l,i) * RecC[order[l]];
+      }
+
+      ModGramSchmidt(i, H, W);
+
+      for (auto l = 0ul; l <= i+1; l++) H0(l,i) = H(l,i);
+
+      /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+       new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+      for (unsigned long l = 0; l < i; l++)
+        ApplyGivens(sn[l], cs[l], H[l][i], H[l+1][i]);
+      GenerateGivens(H[i][i], H[i+1][i], sn[i], cs[i]);
+      ApplyGivens(sn[i], cs[i], g[i], g[i+1]);
+
+      beta = fabs(g[i+1]);
+      i++;
+      iter++;
+
+      /*---  Output the relative residual if necessary ---*/
+
+      if (((monitoring) && (master)) && (iter % 10 == 0))
+        WriteHistory(iter, beta/norm0);
+
+      if (beta < tol*norm0) break;
+    }
+
+    SolveReduced(i, H, g, y);
+
+    /*--- Correction of the cycle, d = Z y - U B y, and its product with the matrix, A d = W H y,
+     *    they are formed in the free slot of the recycled subspace. ---*/
+
+    unsigned long slot = 0;
+    while (find(order.begin(), order.end(), slot) != order.end()) slot++;
+
+    auto& d = RecU[slot];
+    auto& c = RecC[slot];
+    d = ScalarType(0);
+    c = ScalarType(0);
+
+    for (auto l = 0ul; l < i; l++) d += y[l] * Z[l];
+
+    for (auto l = 0ul; l < nRec; l++) {
+      ScalarType By = 0.0;
+      for (auto j = 0ul; j < i; j++) By += B(l,j) * y[j];
+      d -= By * RecU[order[l]];
+    }
+
+    for (auto l = 0ul; l <= i; l++) {
+      ScalarType Hy = 0.0;
+      for (auto j = 0ul; j < i; j++) Hy += H0(l,j) * y[j];
+      c += Hy * W[l];
+    }
+
+    /*--- Update the solution and residual (for the next cycle). ---*/
+
+    x += d;
+    W[0] = betaCycle * W[0] - c;
+    beta = W[0].norm();
+
+    /*--- Add the correction to the recycled subspace (c is orthogonal to C by construction),
+     *    the oldest direction is dropped when the subspace is full. ---*/
+
+    if (k > 0) {
+      const ScalarType nrm = c.norm();
+      if (nrm > 0.0) {
+        c /= nrm;
+        d /= nrm;
+        order.push_back(slot);
+        if (order.size() > k) order.erase(order.begin());
+      }
+    }
+  }
+
+  /*--- Store the recycled subspace for the next solve. ---*/
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  rec_order = order;
+  SU2_OMP_BARRIER
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("GCRO", iter, beta/norm0);
+
+    mat_vec(x, W[0]);
+    W[0] -= b;
+    ScalarType res = W[0].norm();
+
+    if (fabs(res - beta) > tol*10) {
+      if (master) {
+        WriteWarning(beta, res, tol);
+      }
+    }
+
+  }
+
+  residual = beta/norm0;
+  return iter;
+
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                         const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -847,9 +1699,9 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       break;
   }
 
-  /*--- Build preconditioner. ---*/
+  /*--- Build preconditioner, unless the one from the previous call is to be reused. ---*/
 
-  precond->Build();
+  if (!reuse_precond) precond->Build();
 
   /*--- Solve system. ---*/
 
@@ -866,6 +1718,18 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
+    case PIPELINED_CG:
+      IterLinSol = PipelinedCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
+    case PIPELINED_GMRES:
+      IterLinSol = PipelinedGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = PipelinedBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
+    case RECYCLING_GCRO:
+      IterLinSol = RecyclingGCRO_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
     case RESTARTED_FGMRES:
       norm0 = LinSysRes_ptr->norm();
       while (IterLinSol < MaxIter) {
@@ -876,6 +1740,15 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       }
       break;
     case SMOOTHER:
+      if (Jacobian.GetILUInPlace()) {
+        /*--- The matrix was overwritten by its factorization, only one sweep (from x = 0) is possible
+         *    and the residual cannot be computed, the iteration is treated like a direct solve. ---*/
+        (*precond)(*LinSysRes_ptr, *LinSysSol_ptr);
+        *LinSysSol_ptr *= SU2_TYPE::GetValue(config->GetLinear_Solver_Smoother_Relaxation());
+        IterLinSol = 1;
+        residual = 1e-20;
+        break;
+      }
       IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case PASTIX_LDLT : case PASTIX_LU:
@@ -1014,6 +1887,18 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
       break;
+    case PIPELINED_CG:
+      IterLinSol = PipelinedCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
+    case PIPELINED_GMRES:
+      IterLinSol = PipelinedGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = PipelinedBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
+    case RECYCLING_GCRO:
+      IterLinSol = RecyclingGCRO_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
     case RESTARTED_FGMRES:
       IterLinSol = 0;
       Norm0 = LinSysRes_ptr->norm();
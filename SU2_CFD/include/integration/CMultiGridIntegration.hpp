@@ -53,6 +53,14 @@ public:
                            unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
 
 private:
+  /*!
+   * \brief Enable or disable the assembly of Jacobians (implicit integration) during the residual evaluation,
+   *        used when the solver reuses the Jacobian of a previous iteration.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] assemble - Whether to assemble the Jacobian.
+   */
+  void SetJacobianAssembly(CConfig *config, bool assemble) const;
+
   /*!
    * \brief Perform a Full-Approximation Storage (FAS) Multigrid.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -71,14 +79,15 @@ private:
 
   /*!
    * \brief Compute the forcing term.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[in] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] sol_coarse - Pointer to the solution on the coarse grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] geo_coarse - Geometrical definition of the coarse grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
-                       CGeometry *geo_coarse, CConfig *config, unsigned short iMesh);
+  void SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                       CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config, unsigned short iMesh);
 
   /*!
    * \brief Add the truncation error to the residual.
@@ -89,11 +98,14 @@ private:
 
   /*!
    * \brief Set the value of the corrected fine grid solution.
+   * \note The turbulence variables (except negative SA) are kept positive.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[out] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine, CConfig *config, unsigned short iMesh);
+  void SetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CGeometry *geo_fine,
+                                 CConfig *config, unsigned short iMesh);
 
   /*!
    * \brief Compute the gradient in coarse grid using the fine grid information.
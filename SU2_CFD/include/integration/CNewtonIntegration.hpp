@@ -0,0 +1,131 @@
+/*!
+ * \file CNewtonIntegration.hpp
+ * \brief Declaration of the Jacobian-free Newton-Krylov integration of steady compressible flows.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CIntegration.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+/*!
+ * \class CNewtonIntegration
+ * \brief Jacobian-free Newton-Krylov integration of steady compressible flows.
+ * \note The iterations start as the usual implicit pseudo-time steps. Once the CFL is high
+ *       enough, the linear systems are solved with FGMRES using the exact Jacobian-vector
+ *       products (Frechet derivatives of the residual by finite differences), preconditioned
+ *       by the approximate Jacobian of the flow solver and the configured linear solver.
+ */
+class CNewtonIntegration final : public CIntegration {
+private:
+  enum : size_t {OMP_MAX_SIZE = 512}; /*!< \brief Max chunk size for the point loops. */
+
+  /*!
+   * \brief Matrix-free product with the pseudo-transient Newton matrix (V/dt + dR/dU).
+   */
+  class CFrechetProduct final : public CMatrixVectorProduct<su2double> {
+    CNewtonIntegration& integration;
+  public:
+    CFrechetProduct(CNewtonIntegration& integration_ref) : integration(integration_ref) {}
+    inline void operator()(const CSysVector<su2double> & u, CSysVector<su2double> & v) const override {
+      integration.MatrixFreeProduct(u, v);
+    }
+  };
+
+  /*!
+   * \brief Approximate solution of the system of the flow solver (approximate Jacobian).
+   */
+  class CApproxJacobianPreconditioner final : public CPreconditioner<su2double> {
+    CNewtonIntegration& integration;
+  public:
+    CApproxJacobianPreconditioner(CNewtonIntegration& integration_ref) : integration(integration_ref) {}
+    inline void operator()(const CSysVector<su2double> & u, CSysVector<su2double> & v) const override {
+      integration.Preconditioner(u, v);
+    }
+  };
+
+  /*--- The problem being solved, set at the start of each iteration. ---*/
+  CGeometry* geometry = nullptr;
+  CSolver** solvers = nullptr;
+  CNumerics** numerics = nullptr;
+  CConfig* config = nullptr;
+  unsigned short RunTime_EqSystem = 0;
+  unsigned short MainSolver = 0;
+  size_t omp_chunk_size = OMP_MAX_SIZE;
+
+  CSysSolve<su2double> LinSolver; /*!< \brief Outer (matrix-free) Krylov solver. */
+  CSysVector<su2double> LinSysRhs; /*!< \brief Right hand side of the Newton system (-R(U0)). */
+  CSysVector<su2double> LinSysSol; /*!< \brief Newton increment. */
+  CSysVector<su2double> Solution0; /*!< \brief Solution about which the residual is linearized. */
+  vector<su2double> PseudoTimeDiag; /*!< \brief Pseudo-time term V/dt of each point, negative if frozen (dt = 0). */
+  su2double SolutionNorm = 0.0;   /*!< \brief Norm of Solution0, to scale the finite difference step. */
+
+  /*!
+   * \brief Evaluate the residual of the flow solver at its current solution (stored in its LinSysRes).
+   */
+  void ComputeResiduals();
+
+  /*!
+   * \brief Jacobian-vector product by finite differences of the residual.
+   * \param[in] u - Vector being multiplied.
+   * \param[out] v - Result of the product.
+   */
+  void MatrixFreeProduct(const CSysVector<su2double>& u, CSysVector<su2double>& v);
+
+  /*!
+   * \brief Apply the preconditioner, i.e. solve with the approximate Jacobian.
+   * \param[in] u - Vector being preconditioned.
+   * \param[out] v - Result of the preconditioning.
+   */
+  void Preconditioner(const CSysVector<su2double>& u, CSysVector<su2double>& v);
+
+  /*!
+   * \brief Solve the Newton system, the increment is stored in the LinSysSol of the flow solver.
+   * \return Number of Krylov iterations.
+   */
+  unsigned long NewtonStep();
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   */
+  CNewtonIntegration();
+
+  /*!
+   * \brief Iteration of the flow solver, pseudo-time steps or Newton steps depending on the CFL.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method (the way in which the equations are solved).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[in] iZone - Current zone.
+   * \param[in] iInst - Current instance.
+   */
+  void MultiGrid_Iteration(CGeometry ****geometry, CSolver *****solver_container,
+                           CNumerics ******numerics_container, CConfig **config,
+                           unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
+
+};
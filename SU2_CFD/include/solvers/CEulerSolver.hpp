@@ -119,6 +119,14 @@ protected:
   su2double Global_Delta_Time = 0.0, /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
+  /*--- Lagged Jacobian, see JACOBIAN_REUSE_FREQUENCY. ---*/
+
+  bool ReuseJacobian = false;           /*!< \brief The Jacobian of a previous iteration is reused in the current one. */
+  unsigned long JacobianAge = 0;        /*!< \brief Number of linear solves done with the current Jacobian. */
+  unsigned long IterLinSolverFresh = 0; /*!< \brief Linear iterations needed with the last fresh Jacobian. */
+  su2double ResLinSolverFresh = 0.0;    /*!< \brief Linear residual reached with the last fresh Jacobian. */
+  su2double CFLFresh = 0.0;             /*!< \brief CFL number when the last fresh Jacobian was assembled. */
+
   /*--- Turbomachinery Solver Variables ---*/
 
   su2double ***AverageFlux = nullptr,
@@ -161,11 +169,20 @@ protected:
   /*--- End of Turbomachinery Solver Variables ---*/
 
   /*!
-   * \brief Generic implementation of explicit iterations (RK, Classic RK and EULER).
+   * \brief Generic implementation of explicit iterations (RK, Classic RK, low-storage RK, and EULER).
    */
   template<ENUM_TIME_INT IntegrationType>
   void Explicit_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep);
 
+  /*!
+   * \brief Implicit residual smoothing, (1 - eps*L) R' = R is solved with Jacobi sweeps, where L is the
+   *        (undivided) Laplacian of the edge graph. The truncation error (multigrid) is included in R,
+   *        the unsmoothed values are kept in the Residual_Old of the nodes for the monitoring.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ImplicitResidualSmoothing(CGeometry *geometry, const CConfig *config);
+
   /*!
    * \brief Preprocessing actions common to the Euler and NS solvers.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -768,6 +785,18 @@ public:
                               CConfig *config,
                               unsigned short iRKStep) final;
 
+  /*!
+   * \brief Update the solution using a low-storage (two register) Runge-Kutta scheme.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   */
+  void LowStorageRK_Iteration(CGeometry *geometry,
+                              CSolver **solver_container,
+                              CConfig *config,
+                              unsigned short iRKStep) final;
+
   /*!
    * \brief Check for convergence of the Fixed CL mode to the target CL
    * \param[in] config - Definition of the particular problem.
@@ -826,6 +855,41 @@ public:
                                CSolver **solver_container,
                                CConfig *config) final;
 
+  /*!
+   * \brief Build the implicit system (pseudo-time diagonal and right hand side) and compute the residual norms.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PrepareImplicitIteration(CGeometry *geometry,
+                                CSolver **solver_container,
+                                CConfig *config) final;
+
+  /*!
+   * \brief Decide if the Jacobian can be reused in the next implicit iteration, it is assembled again
+   *        after JACOBIAN_REUSE_FREQUENCY iterations, or earlier if the linear convergence degrades
+   *        or the CFL is reduced.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iter - Iterations of the last linear solve.
+   * \param[in] residual - Residual of the last linear solve.
+   */
+  void UpdateJacobianReuse(const CConfig *config, unsigned long iter, su2double residual);
+
+  /*!
+   * \brief Whether the Jacobian of a previous iteration is reused in the current one.
+   */
+  inline bool GetReuseJacobian() const final { return ReuseJacobian; }
+
+  /*!
+   * \brief Update the solution with the increments in LinSysSol (under-relaxed) and communicate it.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CompleteImplicitIteration(CGeometry *geometry,
+                                 CSolver **solver_container,
+                                 CConfig *config) final;
+
   /*!
    * \brief Provide the mass flow rate.
    * \param val_marker Surface where the coeficient is going to be computed.
@@ -40,10 +40,12 @@
 class CFEM_DG_EulerSolver : public CSolver {
 protected:
 
+  enum : size_t {OMP_MIN_SIZE_DG = 16}; /*!< \brief Minimum number of elements/faces per OpenMP block. */
+
   su2double Gamma;           /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
-  CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModel; /*!< \brief Fluid model used in the solver, one object per OpenMP thread. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -167,11 +169,19 @@ protected:
                                                                        elements of a higher time level and the time integration
                                                                        points for ADER-DG. */
 
-  unsigned int sizeWorkArray;     /*!< \brief The size of the work array needed. */
+  unsigned int sizeWorkArray;        /*!< \brief The size of the work array needed. */
+  unsigned int sizeWorkArraySumFact; /*!< \brief The size of the part at the end of the work array, which is
+                                                 reserved for the sum factorization of the standard elements.
+                                                 Only used by Volume_Residual. */
 
   vector<su2double> TolSolADER;   /*!< \brief Vector, which stores the tolerances for the conserved
                                               variables in the ADER predictor step. */
 
+  vector<passivedouble> workTimeLevels; /*!< \brief Measured wall clock time of the computational tasks per
+                                                     time level, used to determine the load imbalance. */
+  unsigned long nStepsWorkTimeLevels = 0; /*!< \brief Number of time steps over which workTimeLevels
+                                                       has been accumulated. */
+
   vector<su2double> VecSolDOFs;    /*!< \brief Vector, which stores the solution variables in the owned DOFs. */
   vector<su2double> VecSolDOFsNew; /*!< \brief Vector, which stores the new solution variables in the owned DOFs (needed for classical RK4 scheme). */
   vector<su2double> VecDeltaTime;  /*!< \brief Vector, which stores the time steps of the owned volume elements. */
@@ -209,6 +219,13 @@ protected:
                                                                           faces for the time levels of internal faces
                                                                           between an owned and a halo element. */
 
+  vector<unsigned long> startLocResMatchingFaces;   /*!< \brief The starting location in the residual of the faces
+                                                                for every matching internal face. Needed to
+                                                                split the face loops over the OpenMP threads. */
+  vector<vector<unsigned long> > startLocResSurfElemMarkers; /*!< \brief The starting location in the residual of the
+                                                                         faces for every surface element of the
+                                                                         boundary markers. */
+
   bool symmetrizingTermsPresent;    /*!< \brief Whether or not symmetrizing terms are present in the
                                                 discretization. */
 
@@ -324,7 +341,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Compute the density at the infinity.
@@ -441,7 +458,9 @@ public:
 
   /*!
    * \brief Function, which processes the list of tasks to be executed by
-            the DG solver.
+            the DG solver. Communication tasks are given priority, such that the
+            halo data of a time level is sent as soon as it is available and the
+            communication overlaps with the computational tasks.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] numerics - Description of the numerical method.
@@ -491,6 +510,16 @@ public:
    */
   void TolerancesADERPredictorStep(void);
 
+  /*!
+   * \brief Function, which determines the load imbalance between the ranks from
+            the measured wall clock time of the computational tasks per time level.
+            The imbalance and the measured work per element of the time levels are
+            reported every 100 time steps. This is a diagnostic only, the partitioning
+            is not changed.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void MeasureLoadImbalanceTimeLevels(CConfig *config);
+
   /*!
    * \brief Function, carries out the predictor step of the ADER-DG
             time integration.
@@ -559,13 +588,14 @@ public:
 
   /*!
    * \brief Function, which computes the spatial residual for the DG discretization.
+            The surface elements of every boundary are distributed over the OpenMP threads.
    * \param[in]  timeLevel           - Time level of the time accurate local time stepping,
                                        if relevant.
    * \param[in]  config              - Definition of the particular problem.
-   * \param[in]  numerics            - Description of the numerical method.
+   * \param[in]  numerics            - Description of the numerical method (all threads).
    * \param[in]  haloInfoNeededForBC - If true,  treat boundaries for which halo data is needed.
                                        If false, treat boundaries for which only owned data is needed.
-   * \param[out] workArray           - Work array.
+   * \param[out] workArray           - Work array, sizeWorkArray entries per thread.
    */
   void Boundary_Conditions(const unsigned short timeLevel,
                            CConfig              *config,
@@ -573,6 +603,27 @@ public:
                            const bool           haloInfoNeededForBC,
                            su2double            *workArray);
 
+  /*!
+   * \brief Function, which applies the boundary condition of the given marker
+            to a range of its surface elements.
+   * \param[in]  config        - Definition of the particular problem.
+   * \param[in]  iMarker       - Index of the boundary marker.
+   * \param[in]  surfElemBeg   - Start index in the list of surface elements.
+   * \param[in]  surfElemEnd   - End index (not included) in the list of surface elements.
+   * \param[in]  surfElem      - Array of surface elements of the marker.
+   * \param[out] resFaces      - Array where the residual of surfElemBeg must be stored.
+   * \param[in]  conv_numerics - Description of the numerical method of the current thread.
+   * \param[out] workArray     - Work array.
+   */
+  void BoundaryConditionsSurfElem(CConfig                  *config,
+                                  const unsigned short     iMarker,
+                                  const unsigned long      surfElemBeg,
+                                  const unsigned long      surfElemEnd,
+                                  const CSurfaceElementFEM *surfElem,
+                                  su2double                *resFaces,
+                                  CNumerics                *conv_numerics,
+                                  su2double                *workArray);
+
   /*!
    * \brief Compute the spatial residual for the given range of faces. It is a virtual
             function, because this function is overruled for Navier-Stokes.
@@ -1683,4 +1734,51 @@ protected:
     NPad  = llEnd*nVar;
     if( NPad%nPadMin ) NPad += nPadMin - (NPad%nPadMin);
   }
+
+  /*!
+   * \brief Template function, which carries out a kernel for a range of volume
+            elements or faces using OpenMP. The range is split into blocks, which
+            are distributed dynamically over the threads, such that the kernel must
+            only be able to handle an arbitrary contiguous subrange.
+   * \param[in] indBeg    - Begin index of the range.
+   * \param[in] indEnd    - End index (not included) of the range.
+   * \param[in] workArray - Work array, which contains sizeWorkArray entries per thread.
+   * \param[in] kernel    - Functor, which is called with the arguments
+                             (blockBeg, blockEnd, thread, workArrayThread).
+   */
+  template <class TKernel>
+  void LoopOverRangeOMP(const unsigned long indBeg,
+                        const unsigned long indEnd,
+                        su2double           *workArray,
+                        const TKernel       &kernel) {
+
+    if(indEnd <= indBeg) return;
+
+    /* No need to create a parallel region when only one thread is used. */
+    const unsigned long nThreads = omp_get_max_threads();
+    if(nThreads == 1) {
+      kernel(indBeg, indEnd, 0, workArray);
+      return;
+    }
+
+    /* Determine the block size, such that every thread gets a couple of
+       blocks for load balancing, while the blocks are big enough to treat
+       several elements simultaneously in the gemm calls. */
+    const unsigned long nItems    = indEnd - indBeg;
+    const unsigned long blockSize = max(roundUpDiv(nItems, 4*nThreads), (size_t) OMP_MIN_SIZE_DG);
+    const unsigned long nBlocks   = roundUpDiv(nItems, blockSize);
+
+    SU2_OMP_PARALLEL
+    {
+      const int thread = omp_get_thread_num();
+      su2double *workArrayThread = workArray ? workArray + thread*sizeWorkArray : nullptr;
+
+      SU2_OMP_FOR_DYN(1)
+      for(unsigned long iBlock=0; iBlock<nBlocks; ++iBlock) {
+        const unsigned long blockBeg = indBeg + iBlock*blockSize;
+        const unsigned long blockEnd = min(blockBeg+blockSize, indEnd);
+        kernel(blockBeg, blockEnd, thread, workArrayThread);
+      }
+    }
+  }
 };
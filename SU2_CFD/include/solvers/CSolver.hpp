@@ -1516,6 +1516,18 @@ public:
                                              CConfig *config,
                                              unsigned short iRKStep) { }
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   */
+  inline virtual void LowStorageRK_Iteration(CGeometry *geometry,
+                                             CSolver **solver_container,
+                                             CConfig *config,
+                                             unsigned short iRKStep) { }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1536,6 +1548,26 @@ public:
                                               CSolver **solver_container,
                                               CConfig *config) { }
 
+  /*!
+   * \brief A virtual member, first half of the implicit Euler iteration (linear system setup).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void PrepareImplicitIteration(CGeometry *geometry,
+                                               CSolver **solver_container,
+                                               CConfig *config) { }
+
+  /*!
+   * \brief A virtual member, second half of the implicit Euler iteration (solution update).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void CompleteImplicitIteration(CGeometry *geometry,
+                                                CSolver **solver_container,
+                                                CConfig *config) { }
+
   /*!
    * \brief A virtual member.
    * \param[in] solver - Container vector with all the solutions.
@@ -4529,7 +4561,20 @@ public:
    */
   inline virtual bool GetHasHybridParallel() const { return false; }
 
+  /*!
+   * \brief Whether the Jacobian (and its preconditioner) of a previous implicit iteration is
+   *        reused in the current one, in which case it must not be modified by the residual assembly.
+   * \return Should return true if "yes", false if "no".
+   */
+  inline virtual bool GetReuseJacobian() const { return false; }
+
 protected:
+  /*!
+   * \brief Print the memory used by the Jacobian and its preconditioners (sum over all ranks).
+   * \note Collective call, it must be made by all the ranks (after the Jacobian is initialized).
+   */
+  void ReportJacobianMemory() const;
+
   /*!
    * \brief Allocate the memory for the verification solution, if necessary.
    * \param[in] nDim   - Number of dimensions of the problem.
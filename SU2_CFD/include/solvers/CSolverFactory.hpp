@@ -70,6 +70,7 @@ enum class INTEGRATION_TYPE{
   DEFAULT,
   FEM_DG,
   STRUCTURAL,
+  NEWTON,
   NONE
 };
 
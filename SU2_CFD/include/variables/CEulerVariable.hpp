@@ -55,7 +55,7 @@ protected:
   /*--- Secondary variable definition ---*/
   MatrixType Secondary;        /*!< \brief Primitive variables (T, vx, vy, vz, P, rho, h, c) in compressible flows. */
 
-  MatrixType Solution_New;     /*!< \brief New solution container for Classical RK4. */
+  MatrixType Solution_New;     /*!< \brief New solution container for Classical RK4, second register of the low-storage RK. */
 
 public:
   /*!
@@ -97,6 +97,15 @@ public:
     Solution_New(iPoint,iVar) += val_solution;
   }
 
+  /*!
+   * \brief Set a value of the new solution container (second register of the low-storage RK).
+   * \param[in] iVar - Number of the variable.
+   * \param[in] val_solution - Value of the solution.
+   */
+  inline void SetSolution_New(unsigned long iPoint, unsigned long iVar, su2double val_solution) final {
+    Solution_New(iPoint,iVar) = val_solution;
+  }
+
   /*!
    * \brief Add <i>value</i> to the gradient of the primitive variables.
    * \param[in] iVar - Index of the variable.
@@ -395,6 +395,14 @@ public:
    */
   inline virtual void AddSolution_New(unsigned long iPoint, unsigned long iVar, su2double solution) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] iPoint - Point index.
+   * \param[in] iVar - Number of the variable.
+   * \param[in] solution - Value of the solution.
+   */
+  inline virtual void SetSolution_New(unsigned long iPoint, unsigned long iVar, su2double solution) {}
+
   /*!
    * \brief Add a value to the External vector.
    * \param[in] iPoint - Point index.
@@ -926,6 +926,10 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
 
+    /*--- Make the halo CVs of the coarse levels consistent with their owners. ---*/
+
+    geometry[iMGlevel]->SetHaloControlVolume(config);
+
     /*--- Compute the max length. ---*/
 
     if ((rank == MASTER_NODE) && (!fea) && (iMGlevel == MESH_0)) cout << "Finding max control volume width." << endl;
@@ -1375,9 +1379,7 @@ void CDriver::Integration_Preprocessing(CConfig *config, CSolver **solver, CInte
   if (rank == MASTER_NODE)
     cout << endl <<"----------------- Integration Preprocessing ( Zone " << config->GetiZone() <<" ) ------------------" << endl;
 
-  ENUM_MAIN_SOLVER kindMainSolver = static_cast<ENUM_MAIN_SOLVER>(config->GetKind_Solver());
-
-  integration = CIntegrationFactory::CreateIntegrationContainer(kindMainSolver, solver);
+  integration = CIntegrationFactory::CreateIntegrationContainer(config, solver);
 
 }
 
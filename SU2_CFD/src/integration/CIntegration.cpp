@@ -198,6 +198,9 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
     case (CLASSICAL_RK4_EXPLICIT):
       solver_container[MainSolver]->ClassicalRK4_Iteration(geometry, solver_container, config, iRKStep);
       break;
+    case (LOW_STORAGE_RK_EXPLICIT):
+      solver_container[MainSolver]->LowStorageRK_Iteration(geometry, solver_container, config, iRKStep);
+      break;
     case (EULER_EXPLICIT):
       solver_container[MainSolver]->ExplicitEuler_Iteration(geometry, solver_container, config);
       break;
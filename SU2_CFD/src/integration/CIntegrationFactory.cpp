@@ -30,8 +30,9 @@
 #include "../../include/integration/CMultiGridIntegration.hpp"
 #include "../../include/integration/CStructuralIntegration.hpp"
 #include "../../include/integration/CFEM_DG_Integration.hpp"
+#include "../../include/integration/CNewtonIntegration.hpp"
 
-CIntegration** CIntegrationFactory::CreateIntegrationContainer(ENUM_MAIN_SOLVER kindMainSolver,
+CIntegration** CIntegrationFactory::CreateIntegrationContainer(const CConfig *config,
                                                                const CSolver* const* solver_container){
 
   CIntegration **integration = new CIntegration* [MAX_SOLS]();
@@ -39,7 +40,20 @@ CIntegration** CIntegrationFactory::CreateIntegrationContainer(ENUM_MAIN_SOLVER
   for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++){
     if (solver_container[iSol] != nullptr){
       const SolverMetaData &solverInfo = CSolverFactory::GetSolverMeta(solver_container[iSol]);
-      integration[iSol] = CreateIntegration(solverInfo.integrationType);
+      auto integrationType = solverInfo.integrationType;
+
+      /*--- The compressible flow solvers can replace the multigrid by Newton-Krylov iterations. ---*/
+      const bool compFlow = (solverInfo.solverType == SUB_SOLVER_TYPE::EULER) ||
+                            (solverInfo.solverType == SUB_SOLVER_TYPE::NAVIER_STOKES);
+      if (compFlow && config->GetNewtonKrylov()) integrationType = INTEGRATION_TYPE::NEWTON;
+
+      /*--- The turbulence solvers can use the multigrid levels of the flow. ---*/
+      const bool turb = (solverInfo.solverType == SUB_SOLVER_TYPE::TURB) ||
+                        (solverInfo.solverType == SUB_SOLVER_TYPE::TURB_SA) ||
+                        (solverInfo.solverType == SUB_SOLVER_TYPE::TURB_SST);
+      if (turb && config->GetMultigrid_Turb()) integrationType = INTEGRATION_TYPE::MULTIGRID;
+
+      integration[iSol] = CreateIntegration(integrationType);
     }
   }
 
@@ -66,6 +80,9 @@ CIntegration* CIntegrationFactory::CreateIntegration(INTEGRATION_TYPE integratio
     case INTEGRATION_TYPE::FEM_DG:
       integration = new CFEM_DG_Integration();
       break;
+    case INTEGRATION_TYPE::NEWTON:
+      integration = new CNewtonIntegration();
+      break;
     case INTEGRATION_TYPE::NONE:
       integration = nullptr;
       break;
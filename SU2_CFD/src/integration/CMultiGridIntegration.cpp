@@ -114,6 +114,14 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                                                                          config[iZone], MESH_0, NO_RK_ITER,
                                                                          RunTime_EqSystem, true);
 
+  /*--- The last change of the turbulence solution may be the prolongated correction (no post-smoothing),
+   *    the eddy viscosity used by the next flow iteration and by the output is computed from it. ---*/
+
+  if (RunTime_EqSystem == RUNTIME_TURB_SYS)
+    solver_container[iZone][iInst][MESH_0][Solver_Position]->Postprocessing(geometry[iZone][iInst][MESH_0],
+                                                                            solver_container[iZone][iInst][MESH_0],
+                                                                            config[iZone], MESH_0);
+
   /*--- Compute non-dimensional parameters and the convergence monitor ---*/
 
   NonDimensional_Parameters(geometry[iZone][iInst], solver_container[iZone][iInst],
@@ -124,6 +132,14 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
 
 }
 
+void CMultiGridIntegration::SetJacobianAssembly(CConfig *config, bool assemble) const {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  config->SetKind_TimeIntScheme(assemble? EULER_IMPLICIT : EULER_EXPLICIT);
+  SU2_OMP_BARRIER
+}
+
 void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
                                             CSolver *****solver_container,
                                             CNumerics ******numerics_container,
@@ -158,6 +174,9 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
     case CLASSICAL_RK4_EXPLICIT:
       iRKLimit = 4;
       break;
+    case LOW_STORAGE_RK_EXPLICIT:
+      iRKLimit = config->GetnLowStorageRKStep();
+      break;
     case EULER_EXPLICIT:
     case EULER_IMPLICIT:
       iRKLimit = 1;
@@ -196,10 +215,16 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       }
 
-      /*--- Space integration ---*/
+      /*--- Space integration, without Jacobian if the solver reuses the one of a previous iteration. ---*/
+
+      const bool lagged = implicit && solver_fine->GetReuseJacobian();
+
+      if (lagged) SetJacobianAssembly(config, false);
 
       Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, iRKStep, RunTime_EqSystem);
 
+      if (lagged) SetJacobianAssembly(config, true);
+
       /*--- Time integration, update solution using the old solution plus the solution increment ---*/
 
       Time_Integration(geometry_fine, solver_container_fine, config, iRKStep, RunTime_EqSystem);
@@ -245,7 +270,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     /*--- Compute $P_(k+1) = I^(k+1)_k(r_k) - r_(k+1) ---*/
 
-    SetForcing_Term(solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
+    SetForcing_Term(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
 
     /*--- Restore the time integration settings. ---*/
 
@@ -269,7 +294,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     SmoothProlongated_Correction(RunTime_EqSystem, solver_fine, geometry_fine, config->GetMG_CorrecSmooth(iMesh), 1.25, config);
 
-    SetProlongated_Correction(solver_fine, geometry_fine, config, iMesh);
+    SetProlongated_Correction(RunTime_EqSystem, solver_fine, geometry_fine, config, iMesh);
 
 
     /*--- Solution post-smoothing in the prolongated grid. ---*/
@@ -288,8 +313,14 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
           solver_fine->SetTime_Step(geometry_fine, solver_container_fine, config, iMesh,  config->GetTimeIter());
         }
 
+        const bool lagged = implicit && solver_fine->GetReuseJacobian();
+
+        if (lagged) SetJacobianAssembly(config, false);
+
         Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, iRKStep, RunTime_EqSystem);
 
+        if (lagged) SetJacobianAssembly(config, true);
+
         Time_Integration(geometry_fine, solver_container_fine, config, iRKStep, RunTime_EqSystem);
 
         solver_fine->Postprocessing(geometry_fine, solver_container_fine, config, iMesh);
@@ -351,9 +382,16 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
 
         /*--- For dirichlet boundary condtions, set the correction to zero.
-         Note that Solution_Old stores the correction not the actual value ---*/
+         Note that Solution_Old stores the correction not the actual value.
+         All the turbulence variables are imposed at the walls. ---*/
 
-        sol_coarse->GetNodes()->SetVelSolutionOldZero(Point_Coarse);
+        if (RunTime_EqSystem == RUNTIME_TURB_SYS) {
+          for (iVar = 0; iVar < nVar; iVar++)
+            sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse, iVar, 0.0);
+        }
+        else {
+          sol_coarse->GetNodes()->SetVelSolutionOldZero(Point_Coarse);
+        }
 
       }
     }
@@ -446,7 +484,7 @@ void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_
 
 }
 
-void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine,
+void CMultiGridIntegration::SetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CGeometry *geo_fine,
                                                       CConfig *config, unsigned short iMesh) {
   unsigned long Point_Fine;
   unsigned short iVar;
@@ -455,6 +493,12 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
   const unsigned short nVar = sol_fine->GetnVar();
   const su2double factor = config->GetDamp_Correc_Prolong(); //pow(config->GetDamp_Correc_Prolong(), iMesh+1);
 
+  /*--- The turbulence variables must remain positive (except for the negative SA model),
+   the correction can reduce them at most by a fraction of their current value. ---*/
+
+  const bool positive = (RunTime_EqSystem == RUNTIME_TURB_SYS) && (config->GetKind_Turb_Model() != SA_NEG);
+  const su2double minFraction = 0.1;
+
   SU2_OMP_FOR_STAT(roundUpDiv(geo_fine->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Fine = 0; Point_Fine < geo_fine->GetnPointDomain(); Point_Fine++) {
     Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
@@ -463,7 +507,10 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
       /*--- Prevent a fine grid divergence due to a coarse grid divergence ---*/
       if (Residual_Fine[iVar] != Residual_Fine[iVar])
         Residual_Fine[iVar] = 0.0;
-      Solution_Fine[iVar] += factor*Residual_Fine[iVar];
+      if (positive)
+        Solution_Fine[iVar] = max(Solution_Fine[iVar] + factor*Residual_Fine[iVar], minFraction*Solution_Fine[iVar]);
+      else
+        Solution_Fine[iVar] += factor*Residual_Fine[iVar];
     }
   }
 
@@ -490,8 +537,9 @@ void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSys
   }
 }
 
-void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
-                                            CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
+void CMultiGridIntegration::SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                                            CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config,
+                                            unsigned short iMesh) {
 
   unsigned long Point_Fine, Point_Coarse, iVertex;
   unsigned short iMarker, iVar, iChildren;
@@ -528,7 +576,10 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
-        sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
+        if (RunTime_EqSystem == RUNTIME_TURB_SYS)
+          sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
+        else
+          sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
       }
     }
   }
@@ -0,0 +1,276 @@
+/*!
+ * \file CNewtonIntegration.cpp
+ * \brief Jacobian-free Newton-Krylov integration of steady compressible flows.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/integration/CNewtonIntegration.hpp"
+#include "../../../Common/include/omp_structure.hpp"
+
+
+CNewtonIntegration::CNewtonIntegration() : CIntegration() { }
+
+void CNewtonIntegration::ComputeResiduals() {
+
+  CSolver* solver = solvers[MainSolver];
+
+  /*--- Only the residual is needed, the Jacobian of the solver is the preconditioner
+   *    and should not be modified (as in the restriction step of the multigrid). ---*/
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  config->SetKind_TimeIntScheme(EULER_EXPLICIT);
+  SU2_OMP_BARRIER
+
+  solver->Preprocessing(geometry, solvers, config, MESH_0, 0, RunTime_EqSystem, false);
+
+  Space_Integration(geometry, solvers, numerics, config, MESH_0, 0, RunTime_EqSystem);
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  config->SetKind_TimeIntScheme(EULER_IMPLICIT);
+  SU2_OMP_BARRIER
+}
+
+void CNewtonIntegration::MatrixFreeProduct(const CSysVector<su2double>& u, CSysVector<su2double>& v) {
+
+  CSolver* solver = solvers[MainSolver];
+  CVariable* nodes = solver->GetNodes();
+  const auto nVar = solver->GetnVar();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  const su2double normU = u.norm();
+
+  if (normU == 0.0) {
+    v = su2double(0.0);
+    return;
+  }
+
+  /*--- Finite difference step, the perturbation is relative to the magnitude of the solution. ---*/
+
+  const su2double eps = config->GetNewtonKrylov_Eps() * (1.0 + SolutionNorm) / normU;
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      nodes->SetSolution(iPoint, iVar, Solution0(iPoint,iVar) + eps*u(iPoint,iVar));
+
+  solver->InitiateComms(geometry, config, SOLUTION);
+  solver->CompleteComms(geometry, config, SOLUTION);
+
+  ComputeResiduals();
+
+  /*--- v = V/dt u + (R(U0 + eps u) - R(U0)) / eps, with R(U0) = -LinSysRhs. Points
+   *    with dt = 0 are frozen (identity rows) as in the implicit system of the solver. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (PseudoTimeDiag[iPoint] < 0.0) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        v(iPoint,iVar) = u(iPoint,iVar);
+    }
+    else {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        v(iPoint,iVar) = (solver->LinSysRes(iPoint,iVar) + LinSysRhs(iPoint,iVar)) / eps +
+                         PseudoTimeDiag[iPoint] * u(iPoint,iVar);
+    }
+  }
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    v.SetBlock_Zero(iPoint);
+}
+
+void CNewtonIntegration::Preconditioner(const CSysVector<su2double>& u, CSysVector<su2double>& v) {
+
+  CSolver* solver = solvers[MainSolver];
+
+  v = su2double(0.0);
+
+  solver->System.Solve(solver->Jacobian, u, v, geometry, config);
+
+  /*--- The preconditioner of the approximate Jacobian is built in the first
+   *    application, and reused for the remaining ones of the Newton step. ---*/
+
+  SU2_OMP_MASTER
+  solver->System.SetReusePreconditioner(true);
+  SU2_OMP_BARRIER
+}
+
+unsigned long CNewtonIntegration::NewtonStep() {
+
+  CSolver* solver = solvers[MainSolver];
+  CVariable* nodes = solver->GetNodes();
+  const auto nVar = solver->GetnVar();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  /*--- Linearization point, right hand side, and pseudo-time term. After PrepareImplicitIteration
+   *    the LinSysRes of the solver is -R(U0) (0 for frozen points). ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    const su2double dt = nodes->GetDelta_Time(iPoint);
+    const su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+    PseudoTimeDiag[iPoint] = (dt != 0.0)? Vol / dt : -1.0;
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      Solution0(iPoint,iVar) = nodes->GetSolution(iPoint,iVar);
+      LinSysRhs(iPoint,iVar) = solver->LinSysRes(iPoint,iVar);
+    }
+  }
+
+  LinSysSol = su2double(0.0);
+
+  const su2double norm = Solution0.norm();
+  SU2_OMP_MASTER
+  SolutionNorm = norm;
+  SU2_OMP_BARRIER
+
+  /*--- Inexact Newton step. ---*/
+
+  su2double residual = 0.0;
+  const auto iter = LinSolver.FGMRES_LinSolver(LinSysRhs, LinSysSol, CFrechetProduct(*this),
+                                               CApproxJacobianPreconditioner(*this),
+                                               config->GetNewtonKrylov_Tol(), config->GetNewtonKrylov_Iter(),
+                                               residual, false, config);
+  SU2_OMP_MASTER
+  {
+    solver->System.SetReusePreconditioner(false);
+    solver->SetIterLinSolver(iter);
+    solver->SetResLinSolver(residual);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Restore the linearization point and pass the increment to the solver (ghost points
+   *    are updated by the communication of the new solution). ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      nodes->SetSolution(iPoint, iVar, Solution0(iPoint,iVar));
+      solver->LinSysSol(iPoint,iVar) = LinSysSol(iPoint,iVar);
+    }
+  }
+
+  return iter;
+}
+
+void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_container,
+                                             CSolver *****solver_container,
+                                             CNumerics ******numerics_container,
+                                             CConfig **config_container,
+                                             unsigned short EqSystem,
+                                             unsigned short iZone,
+                                             unsigned short iInst) {
+
+  config = config_container[iZone];
+  RunTime_EqSystem = EqSystem;
+  MainSolver = config->GetContainerPosition(RunTime_EqSystem);
+  geometry = geometry_container[iZone][iInst][MESH_0];
+  solvers = solver_container[iZone][iInst][MESH_0];
+  numerics = numerics_container[iZone][iInst][MESH_0][MainSolver];
+
+  CSolver* solver = solvers[MainSolver];
+
+  /*--- Switch from pseudo-time steps to Newton steps once the CFL is high enough,
+   *    the smallest local value is used with adaptive CFL. ---*/
+
+  const su2double CFL = config->GetCFL_Adapt()? solver->GetMin_CFL_Local() : config->GetCFL(MESH_0);
+  const bool newton = (CFL >= config->GetNewtonKrylov_CFL());
+
+  if (newton && PseudoTimeDiag.empty()) {
+    const auto nPoint = geometry->GetnPoint();
+    const auto nPointDomain = geometry->GetnPointDomain();
+    const auto nVar = solver->GetnVar();
+
+    LinSysRhs.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    Solution0.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    PseudoTimeDiag.resize(nPointDomain, 0.0);
+
+    if (rank == MASTER_NODE)
+      cout << "Switching to Newton-Krylov iterations (CFL = " << CFL << ")." << endl;
+  }
+
+  omp_chunk_size = computeStaticChunkSize(geometry->GetnPoint(), omp_get_max_threads(), OMP_MAX_SIZE);
+
+  /*--- Start an OpenMP parallel region covering the entire iteration, if the solver supports it. ---*/
+
+  SU2_OMP_PARALLEL_(if(solver->GetHasHybridParallel()))
+  {
+
+  /*--- Send-Receive boundary conditions, and preprocessing ---*/
+
+  solver->Preprocessing(geometry, solvers, config, MESH_0, 0, RunTime_EqSystem, false);
+
+  /*--- Set the old solution, and compute the time step. ---*/
+
+  solver->Set_OldSolution();
+
+  solver->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
+
+  /*--- Space integration, residual and approximate Jacobian. ---*/
+
+  Space_Integration(geometry, solvers, numerics, config, MESH_0, 0, RunTime_EqSystem);
+
+  /*--- Update the solution, pseudo-time step or Newton step. ---*/
+
+  if (!newton) {
+    Time_Integration(geometry, solvers, config, 0, RunTime_EqSystem);
+  }
+  else {
+    solver->PrepareImplicitIteration(geometry, solvers, config);
+
+    NewtonStep();
+
+    solver->CompleteImplicitIteration(geometry, solvers, config);
+  }
+
+  /*--- Send-Receive boundary conditions, and postprocessing ---*/
+
+  solver->Postprocessing(geometry, solvers, config, MESH_0);
+
+  /*--- Computes primitive variables and gradients (useful for the next solver (turbulence) and output ---*/
+
+  solver->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RunTime_EqSystem, true);
+
+  /*--- Calculate the inviscid and viscous forces ---*/
+
+  SU2_OMP_MASTER
+  {
+    solver->Pressure_Forces(geometry, config);
+    solver->Momentum_Forces(geometry, config);
+    solver->Friction_Forces(geometry, config);
+
+    /*--- Evaluate the buffet metric if requested ---*/
+
+    if (config->GetBuffet_Monitoring() || config->GetKind_ObjFunc() == BUFFET_SENSOR)
+      solver->Buffet_Monitoring(geometry, config);
+  }
+  SU2_OMP_BARRIER
+
+  } // end SU2_OMP_PARALLEL
+
+}
@@ -107,8 +107,12 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
     /*--- Solve the turbulence model ---*/
 
     config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TURB_SYS);
-    integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                      RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    if (config[val_iZone]->GetMultigrid_Turb())
+      integration[val_iZone][val_iInst][TURB_SOL]->MultiGrid_Iteration(geometry, solver, numerics, config,
+                                                                       RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    else
+      integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                                                        RUNTIME_TURB_SYS, val_iZone, val_iInst);
 
     /*--- Solve transition model ---*/
 
@@ -161,6 +161,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    ReportJacobianMemory();
 
     if (config->GetKind_Linear_Solver_Prec() == LINELET) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
@@ -2313,11 +2314,12 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
   }
 
   /*--- Initialize the Jacobian matrix and residual, not needed for the reducer strategy
-   *    as we set blocks (including diagonal ones) and completely overwrite. ---*/
+   *    as we set blocks (including diagonal ones) and completely overwrite. The Jacobian
+   *    is also kept when it is reused from the previous iteration. ---*/
 
   if(!ReducerStrategy && !Output) {
     LinSysRes.SetValZero();
-    if (implicit) Jacobian.SetValZero();
+    if (implicit && !ReuseJacobian) Jacobian.SetValZero();
     else {SU2_OMP_BARRIER} // because of "nowait" in LinSysRes
   }
 
@@ -3508,16 +3510,33 @@ void CEulerSolver::Explicit_Iteration(CGeometry *geometry, CSolver **solver_cont
 
   static_assert(IntegrationType == CLASSICAL_RK4_EXPLICIT ||
                 IntegrationType == RUNGE_KUTTA_EXPLICIT ||
+                IntegrationType == LOW_STORAGE_RK_EXPLICIT ||
                 IntegrationType == EULER_EXPLICIT, "");
 
   const bool adjoint = config->GetContinuous_Adjoint();
 
-  const su2double RK_AlphaCoeff = config->Get_Alpha_RKStep(iRKStep);
+  const su2double RK_AlphaCoeff = (IntegrationType == RUNGE_KUTTA_EXPLICIT)? config->Get_Alpha_RKStep(iRKStep) : 0.0;
 
   /*--- Hard-coded classical RK4 coefficients. Will be added to config. ---*/
   const su2double RK_FuncCoeff[] = {1.0/6.0, 1.0/3.0, 1.0/3.0, 1.0/6.0};
   const su2double RK_TimeCoeff[] = {0.5, 0.5, 1.0, 1.0};
 
+  /*--- Low-storage RK, U = a*U^n + (1-a)*U + B*S, with S = A*S - dt*R(U), S is stored in Solution_New
+   *    and U^n in Solution_Old. The Williamson (2N) schemes have a = 0, the SSP (2R) ones A = 0. ---*/
+  su2double LSRK_A = 0.0, LSRK_B = 0.0, LSRK_a = 0.0;
+  if (IntegrationType == LOW_STORAGE_RK_EXPLICIT) {
+    const auto coeff = config->Get_LowStorageRK_Coeff(iRKStep);
+    LSRK_A = coeff[0]; LSRK_B = coeff[1]; LSRK_a = coeff[2];
+  }
+  /*--- Decided once per stage, the 2N schemes do not read U^n and the 2R ones do not read S. ---*/
+  const bool LSRK_readOld = (LSRK_a != 0.0), LSRK_readNew = (LSRK_A != 0.0);
+
+  /*--- Implicit residual smoothing. ---*/
+
+  const bool smoothing = (config->GetResSmoothing_Coeff() > 0.0);
+
+  if (smoothing && !adjoint) ImplicitResidualSmoothing(geometry, config);
+
   /*--- Set shared residual variables to 0 and declare
    *    local ones for current thread to work on. ---*/
 
@@ -3548,6 +3567,9 @@ void CEulerSolver::Explicit_Iteration(CGeometry *geometry, CSolver **solver_cont
 
         su2double Res = Residual[iVar] + Res_TruncError[iVar];
 
+        /*--- The update uses the smoothed residual, the monitoring the original one. ---*/
+        const su2double ResMonitor = smoothing? nodes->GetResidual_Old(iPoint)[iVar] : Res;
+
         /*--- "Static" switch which should be optimized at compile time. ---*/
         switch(IntegrationType) {
 
@@ -3559,6 +3581,18 @@ void CEulerSolver::Explicit_Iteration(CGeometry *geometry, CSolver **solver_cont
             nodes->AddSolution(iPoint, iVar, -Res*Delta*RK_AlphaCoeff);
             break;
 
+          case LOW_STORAGE_RK_EXPLICIT:
+          {
+            su2double S = -Res*Delta;
+            if (LSRK_readNew) S += LSRK_A*nodes->GetSolution_New(iPoint,iVar);
+            nodes->SetSolution_New(iPoint, iVar, S);
+
+            su2double U = nodes->GetSolution(iPoint,iVar) + LSRK_B*S;
+            if (LSRK_readOld) U += LSRK_a*(nodes->GetSolution_Old(iPoint,iVar) - nodes->GetSolution(iPoint,iVar));
+            nodes->SetSolution(iPoint, iVar, U);
+          }
+          break;
+
           case CLASSICAL_RK4_EXPLICIT:
           {
             su2double tmp_time = -1.0*RK_TimeCoeff[iRKStep]*Delta;
@@ -3578,9 +3612,9 @@ void CEulerSolver::Explicit_Iteration(CGeometry *geometry, CSolver **solver_cont
         }
 
         /*--- Update residual information for current thread. ---*/
-        resRMS[iVar] += Res*Res;
-        if (fabs(Res) > resMax[iVar]) {
-          resMax[iVar] = fabs(Res);
+        resRMS[iVar] += ResMonitor*ResMonitor;
+        if (fabs(ResMonitor) > resMax[iVar]) {
+          resMax[iVar] = fabs(ResMonitor);
           idxMax[iVar] = iPoint;
           coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
         }
@@ -3597,6 +3631,23 @@ void CEulerSolver::Explicit_Iteration(CGeometry *geometry, CSolver **solver_cont
   }
   SU2_OMP_BARRIER
 
+  /*--- The low-storage update is not relative to Solution_Old, where the no-slip walls impose their
+   *    velocity (strong boundary condition), the momentum of the wall points is copied from it. ---*/
+
+  if ((IntegrationType == LOW_STORAGE_RK_EXPLICIT) && !adjoint) {
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (!config->GetViscous_Wall(iMarker)) continue;
+
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (!geometry->nodes->GetDomain(iPoint)) continue;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          nodes->SetSolution(iPoint, iDim+1, nodes->GetSolution_Old(iPoint, iDim+1));
+      }
+    }
+  }
+
   /*--- MPI solution ---*/
 
   InitiateComms(geometry, config, SOLUTION);
@@ -3628,14 +3679,95 @@ void CEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_
   Explicit_Iteration<CLASSICAL_RK4_EXPLICIT>(geometry, solver_container, config, iRKStep);
 }
 
+void CEulerSolver::LowStorageRK_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                          CConfig *config, unsigned short iRKStep) {
+
+  Explicit_Iteration<LOW_STORAGE_RK_EXPLICIT>(geometry, solver_container, config, iRKStep);
+}
+
+void CEulerSolver::ImplicitResidualSmoothing(CGeometry *geometry, const CConfig *config) {
+
+  const su2double eps = config->GetResSmoothing_Coeff();
+
+  /*--- Coherent view of the residual. ---*/
+  SU2_OMP_BARRIER
+
+  /*--- The right hand side (residual + truncation error) is kept in Residual_Old. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
+    su2double* Residual_Old = nodes->GetResidual_Old(iPoint);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      Residual_Old[iVar] = LinSysRes(iPoint,iVar) + Res_TruncError[iVar];
+      LinSysRes(iPoint,iVar) = Residual_Old[iVar];
+    }
+  }
+
+  /*--- Jacobi sweeps over the edge graph, R'_i = (R_i + eps*sum_j R'_j) / (1 + eps*n_i). Only the
+   *    neighbors owned by this rank are used, as the residual of halo points is not complete. ---*/
+
+  for (unsigned short iSweep = 0; iSweep < config->GetResSmoothing_Iter(); iSweep++) {
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      nodes->SetResidualSumZero(iPoint);
+
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint))
+        if (geometry->nodes->GetDomain(jPoint))
+          nodes->AddResidual_Sum(iPoint, LinSysRes.GetBlock(jPoint));
+    }
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      unsigned short nNeigh = 0;
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint))
+        nNeigh += geometry->nodes->GetDomain(jPoint);
+
+      const su2double factor = 1.0 / (1.0 + eps*nNeigh);
+      const su2double* Residual_Sum = nodes->GetResidual_Sum(iPoint);
+      const su2double* Residual_Old = nodes->GetResidual_Old(iPoint);
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        LinSysRes(iPoint,iVar) = (Residual_Old[iVar] + eps*Residual_Sum[iVar]) * factor;
+    }
+  }
+
+  /*--- Remove the truncation error again, it is added by the update. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      LinSysRes(iPoint,iVar) -= Res_TruncError[iVar];
+  }
+
+  /*--- The no-slip walls zeroed the momentum residual of their points (strong boundary condition),
+   *    the sweeps filled it again with the residual of the neighbors. ---*/
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (!config->GetViscous_Wall(iMarker)) continue;
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (!geometry->nodes->GetDomain(iPoint)) continue;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        LinSysRes(iPoint, iDim+1) = 0.0;
+    }
+  }
+
+}
+
 void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   Explicit_Iteration<EULER_EXPLICIT>(geometry, solver_container, config, 0);
 }
 
-void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+void CEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  const bool adjoint = config->GetContinuous_Adjoint();
   const bool roe_turkel = config->GetKind_Upwind_Flow() == TURKEL;
   const bool low_mach_prec = config->Low_Mach_Preconditioning();
 
@@ -3674,22 +3806,25 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
     su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
 
-    /*--- Modify matrix diagonal to assure diagonal dominance ---*/
+    /*--- Modify matrix diagonal to assure diagonal dominance, a reused
+     *    Jacobian keeps the pseudo-time term of its assembly. ---*/
 
     if (nodes->GetDelta_Time(iPoint) != 0.0) {
 
-      su2double Delta = Vol / nodes->GetDelta_Time(iPoint);
+      if (!ReuseJacobian) {
+        su2double Delta = Vol / nodes->GetDelta_Time(iPoint);
 
-      if (roe_turkel || low_mach_prec) {
-        SetPreconditioner(config, iPoint, Delta, LowMachPrec);
-        Jacobian.AddBlock2Diag(iPoint, LowMachPrec);
-      }
-      else {
-        Jacobian.AddVal2Diag(iPoint, Delta);
+        if (roe_turkel || low_mach_prec) {
+          SetPreconditioner(config, iPoint, Delta, LowMachPrec);
+          Jacobian.AddBlock2Diag(iPoint, LowMachPrec);
+        }
+        else {
+          Jacobian.AddVal2Diag(iPoint, Delta);
+        }
       }
     }
     else {
-      Jacobian.SetVal2Diag(iPoint, 1.0);
+      if (!ReuseJacobian) Jacobian.SetVal2Diag(iPoint, 1.0);
       for (unsigned short iVar = 0; iVar < nVar; iVar++) {
         LinSysRes(iPoint,iVar) = 0.0;
         local_Res_TruncError[iVar] = 0.0;
@@ -3738,16 +3873,13 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
     delete [] LowMachPrec;
   }
 
-  /*--- Solve or smooth the linear system. ---*/
-
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
-  SU2_OMP_MASTER
-  {
-    SetIterLinSolver(iter);
-    SetResLinSolver(System.GetResidual());
-  }
   SU2_OMP_BARRIER
 
+}
+
+void CEulerSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+
+  const bool adjoint = config->GetContinuous_Adjoint();
 
   ComputeUnderRelaxationFactor(solver_container, config);
 
@@ -3786,6 +3918,65 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
 }
 
+void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+
+  PrepareImplicitIteration(geometry, solver_container, config);
+
+  /*--- A reused Jacobian is still factorized by the preconditioner. ---*/
+
+  if (ReuseJacobian) {
+    SU2_OMP_MASTER
+    System.SetReusePreconditioner(true);
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Solve or smooth the linear system. ---*/
+
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
+    System.SetReusePreconditioner(false);
+    UpdateJacobianReuse(config, iter, System.GetResidual());
+  }
+  SU2_OMP_BARRIER
+
+  CompleteImplicitIteration(geometry, solver_container, config);
+}
+
+void CEulerSolver::UpdateJacobianReuse(const CConfig *config, unsigned long iter, su2double residual) {
+
+  const unsigned long maxAge = config->GetJacobian_Reuse_Freq();
+  const su2double factor = config->GetJacobian_Reuse_Factor();
+  const su2double CFL = config->GetCFL_Adapt()? Min_CFL_Local : config->GetCFL(MGLevel);
+
+  if (maxAge <= 1) {
+    ReuseJacobian = false;
+    return;
+  }
+
+  /*--- Reference linear convergence of the fresh Jacobian. ---*/
+
+  if (!ReuseJacobian) {
+    JacobianAge = 0;
+    IterLinSolverFresh = max<unsigned long>(iter, 1);
+    ResLinSolverFresh = residual;
+    CFLFresh = CFL;
+  }
+  JacobianAge++;
+
+  /*--- More iterations for the same tolerance, or a worse residual for the same
+   *    (max) iterations, mean the lagged Jacobian is no longer a good approximation.
+   *    If the CFL is reduced, the lagged pseudo-time term makes the system less diagonally
+   *    dominant than the current one, which is usually when robustness is needed. ---*/
+
+  const bool degraded = (iter > factor*IterLinSolverFresh) ||
+                        (residual > max(factor*ResLinSolverFresh, config->GetLinear_Solver_Error()));
+
+  ReuseJacobian = (JacobianAge < maxAge) && !degraded && (CFL >= CFLFresh);
+}
+
 void CEulerSolver::SetPreconditioner(const CConfig *config, unsigned long iPoint,
                                      su2double delta, su2double** preconditioner) const {
 
@@ -10233,6 +10424,7 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
       geometry[iMesh]->SetControlVolume(config, geometry[iMeshFine], UPDATE);
       geometry[iMesh]->SetBoundControlVolume(config, geometry[iMeshFine],UPDATE);
       geometry[iMesh]->SetCoord(geometry[iMeshFine]);
+      geometry[iMesh]->SetHaloControlVolume(config);
       if (dynamic_grid) {
         geometry[iMesh]->SetRestricted_GridVelocity(geometry[iMeshFine], config);
       }
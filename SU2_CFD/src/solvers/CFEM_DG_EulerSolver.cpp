@@ -38,8 +38,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(void) : CSolver() {
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -72,8 +70,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -117,8 +113,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
 
   /*--- Array initialization ---*/
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr; CEff_Inv = nullptr;
   CMx_Inv = nullptr;   CMy_Inv = nullptr;   CMz_Inv = nullptr;
   CFx_Inv = nullptr;   CFy_Inv = nullptr;   CFz_Inv = nullptr;
@@ -261,6 +255,16 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     sizeWorkArray = max(sizeWorkArray, sizePredictorADER);
   }
 
+  /*--- Reserve the memory at the end of the work array, which is needed for
+        the sum factorization of quadrilaterals and hexahedra. ---*/
+  sizeWorkArraySumFact = 0;
+  for(unsigned short i=0; i<nStandardElementsSol; ++i) {
+    const unsigned int sizeSumFact = standardElementsSol[i].GetSizeWorkSumFactorization();
+    sizeWorkArraySumFact = max(sizeWorkArraySumFact, nPadGemm*sizeSumFact);
+  }
+
+  sizeWorkArray += sizeWorkArraySumFact;
+
   /*--- Perform the non-dimensionalization for the flow equations using the
         specified reference values. ---*/
   SetNondimensionalization(config, iMesh, true);
@@ -421,10 +425,14 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   if(config->GetViscous() && (fabs(config->GetTheta_Interior_Penalty_DGFEM()) > 1.e-8))
     symmetrizingTermsPresent = true;
 
-  /*--- First the internal matching faces. ---*/
+  /*--- First the internal matching faces. Also the starting location of every
+        face is stored, such that the faces can be treated by multiple threads. ---*/
   unsigned long sizeVecResFaces = 0;
+  startLocResMatchingFaces.resize(nMatchingInternalFacesWithHaloElem[nTimeLevels]+1);
   for(unsigned long i=0; i<nMatchingInternalFacesWithHaloElem[nTimeLevels]; ++i) {
 
+    startLocResMatchingFaces[i] = sizeVecResFaces;
+
     /* Determine the time level of the face. */
     const unsigned long  elem0     = matchingInternalFaces[i].elemID0;
     const unsigned long  elem1     = matchingInternalFaces[i].elemID1;
@@ -491,6 +499,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
       startLocResInternalFacesWithHaloElem[timeLevel+1] = sizeVecResFaces;
   }
 
+  startLocResMatchingFaces.back() = sizeVecResFaces;
+
   /* Set the uninitialized values of startLocResInternalFacesLocalElem. */
   for(unsigned short i=1; i<=nTimeLevels; ++i) {
     if(startLocResInternalFacesLocalElem[i] == 0)
@@ -507,6 +517,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
   /* The physical boundary faces. Exclude the periodic boundaries,
      because these are not physical boundaries. */
+  startLocResSurfElemMarkers.resize(nMarker);
   for(unsigned short iMarker=0; iMarker<nMarker; ++iMarker) {
     startLocResFacesMarkers[iMarker].assign(nTimeLevels+1, 0);
     startLocResFacesMarkers[iMarker][0] = sizeVecResFaces;
@@ -517,8 +528,12 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
       const unsigned long      nSurfElem = boundaries[iMarker].surfElem.size();
       const CSurfaceElementFEM *surfElem = boundaries[iMarker].surfElem.data();
 
+      startLocResSurfElemMarkers[iMarker].resize(nSurfElem+1);
+
       /*--- Loop over the surface elements and update the required data. ---*/
       for(unsigned long i=0; i<nSurfElem; ++i) {
+
+        startLocResSurfElemMarkers[iMarker][i] = sizeVecResFaces;
         const unsigned short ind       = surfElem[i].indStandardElement;
         const unsigned short nDOFsFace = standardBoundaryFacesSol[ind].GetNDOFsFace();
 
@@ -542,6 +557,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
         const unsigned short timeLevel = volElem[surfElem[i].volElemID].timeLevel;
         startLocResFacesMarkers[iMarker][timeLevel+1] = sizeVecResFaces;
       }
+
+      startLocResSurfElemMarkers[iMarker][nSurfElem] = sizeVecResFaces;
     }
 
     /* Set the unitialized values of startLocResFacesMarkers[iMarker]. */
@@ -733,7 +750,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
 
-  delete FluidModel;
+  for(auto& model : FluidModel) delete model;
   delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -789,6 +806,9 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   unsigned short iDim;
 
+  /*--- Auxiliary (dimensional) FluidModel used to compute the free-stream state. ---*/
+  CFluidModel *auxFluidModel = nullptr;
+
   /*--- Local variables ---*/
 
   su2double Alpha            = config->GetAoA()*PI_NUMBER/180.0;
@@ -816,69 +836,69 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       if (config->GetSystemMeasurements() == SI) config->SetGas_Constant(287.058);
       else if (config->GetSystemMeasurements() == US) config->SetGas_Constant(1716.49);
 
-      FluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case IDEAL_GAS:
 
-      FluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case VW_GAS:
 
-      FluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
+      auxFluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
                                        config->GetPressure_Critical(), config->GetTemperature_Critical());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case PR_GAS:
 
-      FluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
+      auxFluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
                                      config->GetTemperature_Critical(), config->GetAcentric_Factor());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
   }
 
-  Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
+  Mach2Vel_FreeStream = auxFluidModel->GetSoundSpeed();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
 
@@ -927,17 +947,17 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
             from the dimensional version of Sutherland's law or the constant
             viscosity, depending on the input option.---*/
 
-      FluidModel->SetLaminarViscosityModel(config);
+      auxFluidModel->SetLaminarViscosityModel(config);
 
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
 
       Density_FreeStream = Reynolds*Viscosity_FreeStream/(Velocity_Reynolds*config->GetLength_Reynolds());
       config->SetDensity_FreeStream(Density_FreeStream);
-      FluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
-      Pressure_FreeStream = FluidModel->GetPressure();
+      auxFluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
+      Pressure_FreeStream = auxFluidModel->GetPressure();
       config->SetPressure_FreeStream(Pressure_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -945,10 +965,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     else {
 
-      FluidModel->SetLaminarViscosityModel(config);
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      auxFluidModel->SetLaminarViscosityModel(config);
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -962,7 +982,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /*--- For inviscid flow, energy is calculated from the specified
      FreeStream quantities using the proper gas law. ---*/
 
-    Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+    Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
   }
 
@@ -1041,37 +1061,47 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem ---*/
 
-  /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
+  /*--- Delete the original (dimensional) FluidModel object. ---*/
 
-  delete FluidModel;
+  delete auxFluidModel;
 
-  switch (config->GetKind_FluidModel()) {
+  /*--- Create one final fluid model object per OpenMP thread to be able to use them in parallel.
+   *    GetFluidModel() should be used to automatically access the "right" object of each thread. ---*/
 
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+  for(auto& model : FluidModel) delete model;
+  FluidModel.assign(omp_get_max_threads(), nullptr);
 
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+  SU2_OMP_PARALLEL
+  {
+    const int thread = omp_get_thread_num();
 
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+    switch (config->GetKind_FluidModel()) {
 
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case STANDARD_AIR:
+        FluidModel[thread] = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-  }
+      case IDEAL_GAS:
+        FluidModel[thread] = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
+
+      case VW_GAS:
+        FluidModel[thread] = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                                 config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        break;
+
+      case PR_GAS:
+        FluidModel[thread] = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                               config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        break;
+
+    }
+
+    GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+
+  } // end SU2_OMP_PARALLEL
 
-  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+  Energy_FreeStreamND = GetFluidModel()->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (viscous) {
 
@@ -1087,8 +1117,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /* constant thermal conductivity model */
     config->SetKt_ConstantND(config->GetKt_Constant()/Conductivity_Ref);
 
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
+    for(auto model : FluidModel) {
+      model->SetLaminarViscosityModel(config);
+      model->SetThermalConductivityModel(config);
+    }
 
   }
 
@@ -3159,9 +3191,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
           const su2double Mom2         = solDOF[1]*solDOF[1] + solDOF[2]*solDOF[2];
           const su2double StaticEnergy = DensityInv*(solDOF[3] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3185,9 +3217,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
                                        + solDOF[3]*solDOF[3];
           const su2double StaticEnergy = DensityInv*(solDOF[4] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3645,8 +3677,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3677,8 +3709,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3794,14 +3826,152 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
   vector<bool> taskCompleted(tasksList.size(), false);
 
   /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+     warnings in debug mode  about uninitialized memory when padding is applied.
+     Every OpenMP thread gets its own part of the work array. */
+  vector<su2double> workArrayVec(sizeWorkArray*omp_get_max_threads(), 0.0);
   su2double *workArray = workArrayVec.data();
 
+  /* Determine whether or not the wall clock time of the computational tasks
+     must be measured per time level to determine the load imbalance. This is
+     only relevant for a parallel computation with local time stepping. */
+  const bool measureWork = (nTimeLevels > 1) && (size > 1);
+  if(measureWork && (workTimeLevels.size() != nTimeLevels))
+    workTimeLevels.assign(nTimeLevels, 0.0);
+
+  /* Lambda functions, which carry out the computationally intensive kernels
+     for a subrange of elements or faces, such that they can be distributed
+     over the OpenMP threads by LoopOverRangeOMP. */
+  auto predictorKernel = [&](unsigned long elemBeg, unsigned long elemEnd,
+                             int thread, su2double *work) {
+    ADER_DG_PredictorStep(config, elemBeg, elemEnd, work);
+  };
+
+  auto shockCapturingKernel = [&](unsigned long elemBeg, unsigned long elemEnd,
+                                  int thread, su2double *work) {
+    Shock_Capturing_DG(config, elemBeg, elemEnd, work);
+  };
+
+  auto volumeResidualKernel = [&](unsigned long elemBeg, unsigned long elemEnd,
+                                  int thread, su2double *work) {
+    Volume_Residual(config, elemBeg, elemEnd, work);
+  };
+
+  auto surfaceResidualKernel = [&](unsigned long faceBeg, unsigned long faceEnd,
+                                   int thread, su2double *work) {
+    unsigned long indResFaces = startLocResMatchingFaces[faceBeg];
+    ResidualFaces(config, faceBeg, faceEnd, indResFaces,
+                  numerics[CONV_TERM + thread*MAX_TERMS], work);
+  };
+
+  const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+  auto inverseMassMatrixKernel = [&](unsigned long elemBeg, unsigned long elemEnd,
+                                     int thread, su2double *work) {
+    MultiplyResidualByInverseMassMatrix(config, useADER, elemBeg, elemEnd, work);
+  };
+
+  auto updateSolutionKernel = [&](unsigned long elemBeg, unsigned long elemEnd,
+                                  int thread, su2double *work) {
+    ADER_DG_Iteration(elemBeg, elemEnd);
+  };
+
+  /* Lambda function, which determines whether or not all the tasks on which
+     task i depends have been completed. */
+  auto taskIsReady = [&](const unsigned long i) {
+    if( taskCompleted[i] ) return false;
+    for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+      if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
+        return false;
+    }
+    return true;
+  };
+
+  /* Wall clock times at which the forward and reverse communication of the
+     time levels have been posted. These are only used to measure the
+     overlap of communication and computation when PROFILE is defined. */
+  vector<double> timeCommPosted(nTimeLevels, 0.0);
+  vector<double> timeReverseCommPosted(nTimeLevels, 0.0);
+
+  /* Lambda function, which starts the forward or reverse communication
+     of the time level of task i. */
+  auto initiateCommunication = [&](const unsigned long i) {
+    const unsigned short level = tasksList[i].timeLevel;
+    if(tasksList[i].task == CTaskDefinition::INITIATE_MPI_COMMUNICATION) {
+      config->Tick(&timeCommPosted[level]);
+      Initiate_MPI_Communication(config, level);
+    }
+    else {
+      config->Tick(&timeReverseCommPosted[level]);
+      Initiate_MPI_ReverseCommunication(config, level);
+    }
+  };
+
+  /* Lambda function, which attempts to complete the forward or reverse
+     communication of the time level of task i. If commMustBeCompleted is
+     true, a blocking wait is used. When profiling, the time between posting
+     and completing the communication and the time spent in the blocking
+     part are stored per time level. The difference between the two is the
+     time during which the communication was hidden behind computation. */
+  auto completeCommunication = [&](const unsigned long i, const bool commMustBeCompleted) {
+    const unsigned short level = tasksList[i].timeLevel;
+    const bool reverse = tasksList[i].task == CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION;
+
+    double timeWaitStart = 0.0;
+    config->Tick(&timeWaitStart);
+
+    const bool completed = reverse ?
+      Complete_MPI_ReverseCommunication(config, level, commMustBeCompleted) :
+      Complete_MPI_Communication(config, level, commMustBeCompleted);
+
+#ifdef PROFILE
+    if( completed ) {
+      const string name = string(reverse ? "ADER_DG_ReverseComm" : "ADER_DG_Comm")
+                        + "_TimeLevel_" + to_string(level);
+      config->Tock(reverse ? timeReverseCommPosted[level] : timeCommPosted[level],
+                   name + "_Window", 0);
+      config->Tock(timeWaitStart, name + "_Wait", 0);
+    }
+#endif
+    return completed;
+  };
+
   /* While loop to carry out all the tasks in tasksList. */
   unsigned long lowestIndexInList = 0;
   while(lowestIndexInList < tasksList.size()) {
 
+    /*--- Before a computational task is selected, post all communication
+          for which the data is available and test the outstanding
+          communication. In this way the halo data of every time level is
+          sent as soon as its predictor is done, the MPI library gets the
+          opportunity to progress the messages in between the computational
+          tasks, and the tasks depending on halo data become available as
+          early as possible. ---*/
+    for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
+      if( !taskIsReady(i) ) continue;
+
+      switch( tasksList[i].task ) {
+        case CTaskDefinition::INITIATE_MPI_COMMUNICATION:
+        case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION:
+          initiateCommunication(i);
+          taskCompleted[i] = true;
+          break;
+
+        case CTaskDefinition::COMPLETE_MPI_COMMUNICATION:
+        case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION:
+          if( completeCommunication(i, false) ) taskCompleted[i] = true;
+          break;
+
+        default:
+          break;
+      }
+    }
+
+    /* Update the value of lowestIndexInList, as tasks may have been
+       completed in the loop above. */
+    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
+      if( !taskCompleted[lowestIndexInList] ) break;
+
+    if(lowestIndexInList == tasksList.size()) break;
+
     /* Find the next task that can be carried out. The outer loop is there
        to make sure that a communication is completed in case there are no
        other tasks */
@@ -3811,13 +3981,10 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
         /* Determine whether or not it can be attempted to carry out
            this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
-        }
+        if( taskIsReady(i) ) {
 
-        if( taskCanBeCarriedOut ) {
+          /* Store the starting time of the task, if needed. */
+          const passivedouble timeTaskStart = measureWork ? SU2_MPI::Wtime() : 0.0;
 
           /*--- Determine the actual task to be carried out and do so. The
                 only tasks that may fail are the completion of the non-blocking
@@ -3834,7 +4001,7 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
                                            + nVolElemInternalPerTimeLevel[level];
               const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+              LoopOverRangeOMP(elemBeg, elemEnd, workArray, predictorKernel);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -3847,52 +4014,32 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
               const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
               const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
                                            + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
-
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
+              LoopOverRangeOMP(elemBeg, elemEnd, workArray, predictorKernel);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
+            case CTaskDefinition::INITIATE_MPI_COMMUNICATION:
             case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
+              /* Start the MPI communication of the solution in the halo elements
+                 or of the residuals, for which the reverse communication must
+                 be used. Normally this has already been done above. */
+              initiateCommunication(i);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
 
+            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION:
             case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
 
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
+              /* Attempt to complete the MPI communication of the solution or
+                 residual data. For j==0, SU2_MPI::Testall will be used, which
+                 returns false if not all requests can be completed. In that
+                 case the next task on the list is carried out. If j==1, this
+                 means that the next tasks are waiting for this communication
+                 to be completed and hence MPI_Waitall is used. */
+              if( completeCommunication(i, j==1) )
                 taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -3945,8 +4092,9 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
+              LoopOverRangeOMP(nVolElemOwnedPerTimeLevel[level],
+                               nVolElemOwnedPerTimeLevel[level+1],
+                               workArray, shockCapturingKernel);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -3955,8 +4103,9 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
+              LoopOverRangeOMP(nVolElemHaloPerTimeLevel[level],
+                               nVolElemHaloPerTimeLevel[level+1],
+                               workArray, shockCapturingKernel);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -3965,8 +4114,9 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Compute the volume portion of the residual. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
+              LoopOverRangeOMP(nVolElemOwnedPerTimeLevel[level],
+                               nVolElemOwnedPerTimeLevel[level+1],
+                               workArray, volumeResidualKernel);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -3975,10 +4125,9 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /* Compute the residual of the faces that only involve owned elements. */
               const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
+              LoopOverRangeOMP(nMatchingInternalFacesLocalElem[level],
+                               nMatchingInternalFacesLocalElem[level+1],
+                               workArray, surfaceResidualKernel);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -3987,10 +4136,9 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /* Compute the residual of the faces that involve a halo element. */
               const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
+              LoopOverRangeOMP(nMatchingInternalFacesWithHaloElem[level],
+                               nMatchingInternalFacesWithHaloElem[level+1],
+                               workArray, surfaceResidualKernel);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4055,11 +4203,9 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
+              LoopOverRangeOMP(nVolElemOwnedPerTimeLevel[level],
+                               nVolElemOwnedPerTimeLevel[level+1],
+                               workArray, inverseMassMatrixKernel);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4068,8 +4214,9 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Perform the update step for ADER-DG. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
+              LoopOverRangeOMP(nVolElemOwnedPerTimeLevel[level],
+                               nVolElemOwnedPerTimeLevel[level+1],
+                               workArray, updateSolutionKernel);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4080,6 +4227,22 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
               exit(1);
             }
           }
+
+          /* Accumulate the wall clock time of the computational tasks of
+             this time level. The communication tasks are not taken into
+             account, because the waiting time is a consequence of the
+             imbalance rather than a part of the work. */
+          if(measureWork && taskCarriedOut) {
+            switch( tasksList[i].task ) {
+              case CTaskDefinition::INITIATE_MPI_COMMUNICATION:
+              case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION:
+              case CTaskDefinition::COMPLETE_MPI_COMMUNICATION:
+              case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION:
+                break;
+              default:
+                workTimeLevels[tasksList[i].timeLevel] += SU2_MPI::Wtime() - timeTaskStart;
+            }
+          }
         }
 
         /* Break the inner loop if a task has been carried out. */
@@ -4106,10 +4269,82 @@ void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolve
   /* Process the tasks list to carry out one ADER space time integration step. */
   ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
 
+  /* Report the load imbalance of the time levels, if measured. */
+  if( !workTimeLevels.empty() ) MeasureLoadImbalanceTimeLevels(config);
+
   /* Postprocessing. */
   Postprocessing(geometry, solver_container, config, iMesh);
 }
 
+void CFEM_DG_EulerSolver::MeasureLoadImbalanceTimeLevels(CConfig *config) {
+
+  /* Check if the load imbalance must be determined in this time step. */
+  const unsigned long nStepsMeasurement = 100;
+  ++nStepsWorkTimeLevels;
+  if(nStepsWorkTimeLevels < nStepsMeasurement) return;
+
+  /* Easier storage of the number of time levels. */
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
+
+  /*--- Store the locally measured work and the number of owned elements per
+        time level in one buffer, such that a single reduction is needed to
+        obtain the global values. The last entry contains the total local work,
+        from which the maximum over the ranks is determined. ---*/
+  vector<su2double> locBuf(2*nTimeLevels+1), sumBuf(2*nTimeLevels+1);
+  su2double locWork = 0.0;
+  for(unsigned short l=0; l<nTimeLevels; ++l) {
+    locBuf[l]             = workTimeLevels[l];
+    locBuf[nTimeLevels+l] = nVolElemOwnedPerTimeLevel[l+1] - nVolElemOwnedPerTimeLevel[l];
+    locWork              += workTimeLevels[l];
+  }
+  locBuf[2*nTimeLevels] = locWork;
+
+  su2double maxWork = locWork;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(locBuf.data(), sumBuf.data(), 2*nTimeLevels+1, MPI_DOUBLE,
+                     MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&locWork, &maxWork, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+  sumBuf = locBuf;
+#endif
+
+  /* Reset the measurement for the next interval. */
+  nStepsWorkTimeLevels = 0;
+  workTimeLevels.assign(nTimeLevels, 0.0);
+
+  /* Determine the load imbalance, i.e. the ratio of the maximum and the
+     average work per rank. */
+  const su2double totWork = sumBuf[2*nTimeLevels];
+  if(totWork <= 0.0) return;
+  const su2double imbalance = maxWork*size/totWork;
+
+  /*--- Report the imbalance and the measured work per element of every time
+        level, which includes the number of times a time level is processed
+        per time step, relative to the work of the highest time level, which is
+        processed once per time step. The nominal values used in the
+        partitioning are 2^(maxLevel-level). Time levels without elements are
+        reported with the nominal value. ---*/
+  if(rank == MASTER_NODE) {
+
+    unsigned short maxLevel = 0;
+    for(unsigned short l=0; l<nTimeLevels; ++l)
+      if(sumBuf[nTimeLevels+l] > 0.0) maxLevel = l;
+
+    const su2double workRef = sumBuf[maxLevel]/sumBuf[nTimeLevels+maxLevel];
+
+    cout << endl << "Measured load imbalance (max/average work per rank) of the time levels: "
+         << imbalance << "." << endl
+         << "Measured work per element of the time levels, relative to the highest level: (";
+    for(unsigned short l=0; l<nTimeLevels; ++l) {
+      su2double weight = pow(2, max(maxLevel-l, 0));
+      if((sumBuf[nTimeLevels+l] > 0.0) && (workRef > 0.0))
+        weight = sumBuf[l]/(sumBuf[nTimeLevels+l]*workRef);
+      cout << (l ? ", " : " ") << weight;
+    }
+    cout << " )" << endl << endl;
+  }
+}
+
 void CFEM_DG_EulerSolver::TolerancesADERPredictorStep(void) {
 
   /* Determine the maximum values of the conservative variables of the
@@ -4750,8 +4985,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -4999,8 +5234,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5289,8 +5524,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5504,8 +5739,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5682,6 +5917,9 @@ void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig
                                     + iTime*nTimeDOFs;
 
   /* Loop over the element range of this time level. */
+  SU2_OMP_PARALLEL
+  {
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE_DG)
   for(unsigned long l=elemBeg; l<elemEnd; ++l) {
 
     /* Determine the number of solution variables for this element and
@@ -5720,9 +5958,10 @@ void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig
   unsigned short iiTime = iTime;
   if( secondPartTimeInt ) iiTime += config->GetnTimeIntegrationADER_DG();
 
-  DOFToThisTimeInt = timeInterpolAdjDOFToIntegrationADER_DG + iiTime*nTimeDOFs;
+  const su2double *DOFToAdjTimeInt = timeInterpolAdjDOFToIntegrationADER_DG + iiTime*nTimeDOFs;
 
   /* Loop over the adjacent elements. */
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE_DG)
   for(unsigned long l=0; l<nAdjElem; ++l) {
     const unsigned long ll = adjElem[l];
 
@@ -5742,9 +5981,10 @@ void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig
       const su2double *solPred = VecSolDOFsPredictorADER.data()
                                + nVar*(j*nDOFsLocTot + volElem[ll].offsetDOFsSolLocal);
       for(unsigned short i=0; i<nSolVar; ++i)
-        solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
+        solDOFs[i] += DOFToAdjTimeInt[j]*solPred[i];
     }
   }
+  } // end SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::Shock_Capturing_DG(CConfig             *config,
@@ -5802,16 +6042,15 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /* Get the required data from the corresponding standard element. */
     const unsigned short nInt            = standardElementsSol[ind].GetNIntegration();
     const unsigned short nDOFs           = volElem[l].nDOFsSol;
-    const su2double *matBasisInt         = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-    const su2double *matBasisIntTrans    = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
-    const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetDerMatBasisFunctionsIntTrans();
     const su2double *weights             = standardElementsSol[ind].GetWeightsIntegration();
 
-    /*--- Set the pointers for the local arrays. ---*/
-    su2double *solDOFs = workArray;
-    su2double *sources = solDOFs + nDOFs*NPad;
-    su2double *solInt  = sources + nInt *NPad;
-    su2double *fluxes  = solInt  + nInt *NPad;
+    /*--- Set the pointers for the local arrays. The work array for the
+          sum factorization is located at the end of workArray. ---*/
+    su2double *solDOFs     = workArray;
+    su2double *sources     = solDOFs + nDOFs*NPad;
+    su2double *solInt      = sources + nInt *NPad;
+    su2double *fluxes      = solInt  + nInt *NPad;
+    su2double *workSumFact = workArray + (sizeWorkArray - sizeWorkArraySumFact);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Interpolate the solution to the integration points of    ---*/
@@ -5834,9 +6073,10 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
           solDOFs[i*NPad+llNVar+mm] = solDOFsElem[i*nVar+mm];
     }
 
-    /* Call the general function to carry out the matrix product to determine
-       the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+    /* Determine the solution in the integration points of the chunk of
+       elements. Sum factorization is used for quadrilaterals and hexahedra. */
+    standardElementsSol[ind].InterpolateDOFsToIntegrationPoints(NPad, solDOFs, solInt, workSumFact,
+                                                                blasFunctions, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
@@ -5887,8 +6127,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -5982,8 +6222,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6101,16 +6341,18 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Integrate the fluxes against the derivatives of the basis functions.
+       Use solDOFs as a temporary storage for the result. */
+    standardElementsSol[ind].IntegrateFluxesIntegrationPoints(NPad, fluxes, solDOFs, workSumFact,
+                                                              blasFunctions, config);
 
     /* Add the contribution from the source terms, if needed. Use solInt
-       as temporary storage for the matrix product. */
+       as temporary storage for the integration. */
     if( addSourceTerms ) {
 
-      /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+      /* Integrate the source terms against the basis functions. */
+      standardElementsSol[ind].IntegrateDataIntegrationPoints(NPad, sources, solInt, workSumFact,
+                                                              blasFunctions, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -6147,81 +6389,102 @@ void CFEM_DG_EulerSolver::Boundary_Conditions(const unsigned short timeLevel,
   /* Loop over all boundaries. */
   for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
-    /* Check if this boundary marker must be treated at all. */
-    if(boundaries[iMarker].haloInfoNeededForBC == haloInfoNeededForBC) {
+    /* Check if this boundary marker must be treated at all. Nothing needs
+       to be done for a periodic boundary. */
+    if(!boundaries[iMarker].periodicBoundary &&
+       (boundaries[iMarker].haloInfoNeededForBC == haloInfoNeededForBC)) {
 
       /* Determine the range of faces for this time level and test if any
          surface element for this marker must be treated at all. */
       const unsigned long surfElemBeg = boundaries[iMarker].nSurfElem[timeLevel];
       const unsigned long surfElemEnd = boundaries[iMarker].nSurfElem[timeLevel+1];
 
-      if(surfElemEnd > surfElemBeg) {
+      /* Lambda function, which applies the boundary condition to a subrange
+         of the surface elements, such that the work can be distributed over
+         the OpenMP threads. The starting position in the vector for the face
+         residuals is determined by the first surface element of the subrange. */
+      auto bcKernel = [&](unsigned long surfElemBegThread, unsigned long surfElemEndThread,
+                          int thread, su2double *workArrayThread) {
 
-        /* Set the starting position in the vector for the face residuals for
-           this boundary marker and time level and set the pointer to the boundary
-           faces for this boundary marker. */
         su2double *resFaces = VecResFaces.data()
-                            + nVar*startLocResFacesMarkers[iMarker][timeLevel];
+                            + nVar*startLocResSurfElemMarkers[iMarker][surfElemBegThread];
 
         const CSurfaceElementFEM *surfElem = boundaries[iMarker].surfElem.data();
 
-        /* Apply the appropriate boundary condition. */
-        switch (config->GetMarker_All_KindBC(iMarker)) {
-          case EULER_WALL:
-            BC_Euler_Wall(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                          numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case FAR_FIELD:
-            BC_Far_Field(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                         numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case SYMMETRY_PLANE:
-            BC_Sym_Plane(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                         numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case SUPERSONIC_INLET: /* Use far field for this. When a more detailed state
-                                    needs to be specified, use a Riemann boundary. */
-            BC_Far_Field(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                         numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case SUPERSONIC_OUTLET:
-            BC_Supersonic_Outlet(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                                 numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case INLET_FLOW:
-            BC_Inlet(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                     numerics[CONV_BOUND_TERM], iMarker, workArray);
-            break;
-          case OUTLET_FLOW:
-            BC_Outlet(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                      numerics[CONV_BOUND_TERM], iMarker, workArray);
-            break;
-          case ISOTHERMAL:
-            BC_Isothermal_Wall(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                               numerics[CONV_BOUND_TERM], iMarker, workArray);
-            break;
-          case HEAT_FLUX:
-            BC_HeatFlux_Wall(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                             numerics[CONV_BOUND_TERM], iMarker, workArray);
-            break;
-          case RIEMANN_BOUNDARY:
-            BC_Riemann(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                       numerics[CONV_BOUND_TERM], iMarker, workArray);
-            break;
-          case CUSTOM_BOUNDARY:
-            BC_Custom(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                      numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case PERIODIC_BOUNDARY:  // Nothing to be done for a periodic boundary.
-            break;
-          default:
-            SU2_MPI::Error("BC not implemented.", CURRENT_FUNCTION);
-        }
-      }
+        CNumerics *conv_numerics = numerics[CONV_BOUND_TERM + thread*MAX_TERMS];
+
+        BoundaryConditionsSurfElem(config, iMarker, surfElemBegThread, surfElemEndThread,
+                                   surfElem, resFaces, conv_numerics, workArrayThread);
+      };
+
+      LoopOverRangeOMP(surfElemBeg, surfElemEnd, workArray, bcKernel);
     }
   }
 }
 
+void CFEM_DG_EulerSolver::BoundaryConditionsSurfElem(CConfig                  *config,
+                                                     const unsigned short     iMarker,
+                                                     const unsigned long      surfElemBeg,
+                                                     const unsigned long      surfElemEnd,
+                                                     const CSurfaceElementFEM *surfElem,
+                                                     su2double                *resFaces,
+                                                     CNumerics                *conv_numerics,
+                                                     su2double                *workArray) {
+
+  /* Apply the appropriate boundary condition. */
+  switch (config->GetMarker_All_KindBC(iMarker)) {
+    case EULER_WALL:
+      BC_Euler_Wall(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+                    conv_numerics, workArray);
+      break;
+    case FAR_FIELD:
+      BC_Far_Field(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+                   conv_numerics, workArray);
+      break;
+    case SYMMETRY_PLANE:
+      BC_Sym_Plane(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+                   conv_numerics, workArray);
+      break;
+    case SUPERSONIC_INLET: /* Use far field for this. When a more detailed state
+                              needs to be specified, use a Riemann boundary. */
+      BC_Far_Field(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+                   conv_numerics, workArray);
+      break;
+    case SUPERSONIC_OUTLET:
+      BC_Supersonic_Outlet(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+                           conv_numerics, workArray);
+      break;
+    case INLET_FLOW:
+      BC_Inlet(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+               conv_numerics, iMarker, workArray);
+      break;
+    case OUTLET_FLOW:
+      BC_Outlet(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+                conv_numerics, iMarker, workArray);
+      break;
+    case ISOTHERMAL:
+      BC_Isothermal_Wall(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+                         conv_numerics, iMarker, workArray);
+      break;
+    case HEAT_FLUX:
+      BC_HeatFlux_Wall(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+                       conv_numerics, iMarker, workArray);
+      break;
+    case RIEMANN_BOUNDARY:
+      BC_Riemann(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+                 conv_numerics, iMarker, workArray);
+      break;
+    case CUSTOM_BOUNDARY:
+      BC_Custom(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
+                conv_numerics, workArray);
+      break;
+    case PERIODIC_BOUNDARY:  // Nothing to be done for a periodic boundary.
+      break;
+    default:
+      SU2_MPI::Error("BC not implemented.", CURRENT_FUNCTION);
+  }
+}
+
 void CFEM_DG_EulerSolver::ResidualFaces(CConfig             *config,
                                         const unsigned long indFaceBeg,
                                         const unsigned long indFaceEnd,
@@ -6503,7 +6766,12 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADEROwnedElem(
   const unsigned long elemBegOwned = nVolElemOwnedPerTimeLevel[timeLevel];
   const unsigned long elemEndOwned = nVolElemOwnedPerTimeLevel[timeLevel+1];
 
-  /* Add the residuals coming from the volume integral to VecTotResDOFsADER. */
+  /* Add the residuals coming from the volume integral to VecTotResDOFsADER.
+     Note that the element loops only update the DOFs of the element itself,
+     such that they can be distributed over the threads. */
+  SU2_OMP_PARALLEL
+  {
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE_DG)
   for(unsigned long l=elemBegOwned; l<elemEndOwned; ++l) {
     const unsigned long offset  = nVar*volElem[l].offsetDOFsSolLocal;
     const su2double    *res     = VecResDOFs.data() + offset;
@@ -6515,6 +6783,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADEROwnedElem(
 
   /* Add the residuals coming from the surface integral to VecTotResDOFsADER.
      This part is from faces with the same time level as the element. */
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE_DG)
   for(unsigned long l=elemBegOwned; l<elemEndOwned; ++l) {
     for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i) {
       const unsigned long ii = volElem[l].offsetDOFsSolLocal + i;
@@ -6541,7 +6810,8 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADEROwnedElem(
     const unsigned long nAdjElem = ownedElemAdjLowTimeLevel[timeLevel+1].size();
     const unsigned long *adjElem = ownedElemAdjLowTimeLevel[timeLevel+1].data();
 
-    for(unsigned l=0; l<nAdjElem; ++l) {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE_DG)
+    for(unsigned long l=0; l<nAdjElem; ++l) {
       const unsigned long ll = adjElem[l];
       for(unsigned short i=0; i<volElem[ll].nDOFsSol; ++i) {
         const unsigned long ii = volElem[ll].offsetDOFsSolLocal + i;
@@ -6555,6 +6825,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADEROwnedElem(
       }
     }
   }
+  } // end SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADERHaloElem(
@@ -6578,6 +6849,9 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADERHaloElem(
 
   /* Add the residuals coming from the surface integral to VecTotResDOFsADER.
      This part is from faces with the same time level as the element. */
+  SU2_OMP_PARALLEL
+  {
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE_DG)
   for(unsigned long l=elemBegHalo; l<elemEndHalo; ++l) {
     for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i) {
       const unsigned long ii = volElem[l].offsetDOFsSolLocal + i;
@@ -6604,7 +6878,8 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADERHaloElem(
     const unsigned long nAdjElem = haloElemAdjLowTimeLevel[timeLevel+1].size();
     const unsigned long *adjElem = haloElemAdjLowTimeLevel[timeLevel+1].data();
 
-    for(unsigned l=0; l<nAdjElem; ++l) {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE_DG)
+    for(unsigned long l=0; l<nAdjElem; ++l) {
       const unsigned long ll = adjElem[l];
       for(unsigned short i=0; i<volElem[ll].nDOFsSol; ++i) {
         const unsigned long ii = volElem[ll].offsetDOFsSolLocal + i;
@@ -6618,6 +6893,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADERHaloElem(
       }
     }
   }
+  } // end SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
@@ -6635,32 +6911,39 @@ void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
     elemEnd   = nVolElemHaloPerTimeLevel[timeLevel+1];
   }
 
-  /* For the halo elements the residual is initialized to zero. */
-  if( !ownedElements ) {
+  /* The residuals of the faces are gathered per DOF, hence the elements
+     can be treated by the threads without conflicts. */
+  SU2_OMP_PARALLEL
+  {
+    /* For the halo elements the residual is initialized to zero. */
+    if( !ownedElements ) {
 
-    for(unsigned long l=elemStart; l<elemEnd; ++l) {
-      su2double *resDOFsElem = VecResDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
-      for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
-        resDOFsElem[i] = 0.0;
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE_DG)
+      for(unsigned long l=elemStart; l<elemEnd; ++l) {
+        su2double *resDOFsElem = VecResDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
+        for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
+          resDOFsElem[i] = 0.0;
+      }
     }
-  }
 
-  /* Loop over the required element range. */
-  for(unsigned long l=elemStart; l<elemEnd; ++l) {
+    /* Loop over the required element range. */
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE_DG)
+    for(unsigned long l=elemStart; l<elemEnd; ++l) {
 
-    /* Loop over the DOFs of this element. */
-    for(unsigned long i=volElem[l].offsetDOFsSolLocal;
-                      i<(volElem[l].offsetDOFsSolLocal+volElem[l].nDOFsSol); ++i) {
+      /* Loop over the DOFs of this element. */
+      for(unsigned long i=volElem[l].offsetDOFsSolLocal;
+                        i<(volElem[l].offsetDOFsSolLocal+volElem[l].nDOFsSol); ++i) {
 
-      /* Create the final residual by summing up all contributions. */
-      su2double *resDOF = VecResDOFs.data() + nVar*i;
-      for(unsigned long j=nEntriesResFaces[i]; j<nEntriesResFaces[i+1]; ++j) {
-        const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
-        for(unsigned short k=0; k<nVar; ++k)
-          resDOF[k] += resFace[k];
+        /* Create the final residual by summing up all contributions. */
+        su2double *resDOF = VecResDOFs.data() + nVar*i;
+        for(unsigned long j=nEntriesResFaces[i]; j<nEntriesResFaces[i+1]; ++j) {
+          const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
+          for(unsigned short k=0; k<nVar; ++k)
+            resDOF[k] += resFace[k];
+        }
       }
     }
-  }
+  } // end SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::MultiplyResidualByInverseMassMatrix(
@@ -6887,8 +7170,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double v            = sol[2]*DensityInv;
                   const su2double StaticEnergy = sol[3]*DensityInv - 0.5*(u*u + v*v);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -6940,8 +7223,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double w            = sol[3]*DensityInv;
                   const su2double StaticEnergy = sol[4]*DensityInv - 0.5*(u*u + v*v + w*w);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7555,9 +7838,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7663,9 +7946,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7727,10 +8010,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      GetFluidModel()->SetTDState_PT(P_Total, T_Total);
+      const su2double Enthalpy_e = GetFluidModel()->GetStaticEnergy()
+                                 + GetFluidModel()->GetPressure()/GetFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7757,9 +8040,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7789,10 +8072,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7840,10 +8123,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7937,7 +8220,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -7952,7 +8235,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8003,11 +8286,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8082,11 +8365,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -9478,9 +9761,9 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
       su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+      GetFluidModel()->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = GetFluidModel()->GetPressure();
+      su2double Temperature = GetFluidModel()->GetTemperature();
 
       /*--- Use the values at the infinity if the state is not physical. ---*/
       if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
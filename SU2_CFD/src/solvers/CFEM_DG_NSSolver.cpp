@@ -362,10 +362,10 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                 su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
                 su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-                FluidModel->SetTDState_rhoe(solInt[0], eInt);
-                const su2double Pressure = FluidModel->GetPressure();
-                const su2double Temperature = FluidModel->GetTemperature();
-                const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+                GetFluidModel()->SetTDState_rhoe(solInt[0], eInt);
+                const su2double Pressure = GetFluidModel()->GetPressure();
+                const su2double Temperature = GetFluidModel()->GetTemperature();
+                const su2double LaminarViscosity= GetFluidModel()->GetLaminarViscosity();
 
                 /* Subtract the prescribed wall velocity, i.e. grid velocity
                    from the velocity in the exchange point. */
@@ -393,7 +393,7 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                                                                           LaminarViscosity, Pressure,
                                                                           Wall_HeatFlux, HeatFlux_Prescribed,
                                                                           Wall_Temperature, Temperature_Prescribed,
-                                                                          FluidModel, tauWall, qWall,
+                                                                          GetFluidModel(), tauWall, qWall,
                                                                           ViscosityWall, kOverCvWall);
 
                 /* Update the viscous forces and moments. Note that the force direction
@@ -564,8 +564,8 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                     const su2double divVel = dudx + dvdy;
 
                     /* Compute the laminar viscosity. */
-                    FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                    const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+                    GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                    const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
                     /* Set the value of the second viscosity and compute the
                        divergence term in the viscous normal stresses. */
@@ -697,8 +697,8 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                     const su2double divVel = dudx + dvdy + dwdz;
 
                     /* Compute the laminar viscosity. */
-                    FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                    const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+                    GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                    const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
                     /* Set the value of the second viscosity and compute the
                        divergence term in the viscous normal stresses. */
@@ -1057,8 +1057,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /*--- Compute the maximum value of the wave speed. This is a rather
                       conservative estimate. ---*/
-                FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-                const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+                GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+                const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
                 const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
                 const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -1069,7 +1069,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /* Compute the laminar kinematic viscosity and check if an eddy
                    viscosity must be determined. */
-                const su2double muLam = FluidModel->GetLaminarViscosity();
+                const su2double muLam = GetFluidModel()->GetLaminarViscosity();
                 su2double muTurb      = 0.0;
 
                 if( SGSModelUsed ) {
@@ -1174,8 +1174,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /*--- Compute the maximum value of the wave speed. This is a rather
                       conservative estimate. ---*/
-                FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-                const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+                GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+                const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
                 const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
                 const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -1187,7 +1187,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /* Compute the laminar kinematic viscosity and check if an eddy
                    viscosity must be determined. */
-                const su2double muLam = FluidModel->GetLaminarViscosity();
+                const su2double muLam = GetFluidModel()->GetLaminarViscosity();
                 su2double muTurb      = 0.0;
 
                 if( SGSModelUsed ) {
@@ -1431,9 +1431,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[3];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = GetFluidModel()->GetPressure();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -1774,9 +1774,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[4];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = GetFluidModel()->GetPressure();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -2147,13 +2147,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
+      const su2double dViscLamdT   = GetFluidModel()->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -2546,13 +2546,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
        /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
+      const su2double dViscLamdT   = GetFluidModel()->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -3088,8 +3088,8 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
 
       StaticEnergy = sol[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-      SoundSpeed2 = FluidModel->GetSoundSpeed2();
+      GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+      SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
       machSolDOFs[iInd] = sqrt( Velocity2Rel/SoundSpeed2 );
       machMax = max(machSolDOFs[iInd],machMax);
     }
@@ -3211,9 +3211,6 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     /* Get the required data from the corresponding standard element. */
     const unsigned short nInt            = standardElementsSol[ind].GetNIntegration();
     const unsigned short nDOFs           = volElem[l].nDOFsSol;
-    const su2double *matBasisInt         = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-    const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetDerMatBasisFunctionsIntTrans();
-    const su2double *matBasisIntTrans    = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
     const su2double *weights             = standardElementsSol[ind].GetWeightsIntegration();
 
     unsigned short nPoly = standardElementsSol[ind].GetNPoly();
@@ -3225,6 +3222,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     su2double *solAndGradInt = sources       + nInt *NPad;
     su2double *fluxes        = solAndGradInt + nInt *NPad*(nDim+1);
 
+    /* The work array for the sum factorization is located at the end of workArray. */
+    su2double *workSumFact = workArray + (sizeWorkArray - sizeWorkArraySumFact);
+
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Determine the solution variables and their gradients     ---*/
     /*---         w.r.t. the parametric coordinates in the integration     ---*/
@@ -3247,10 +3247,11 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
           solDOFs[i*NPad+llNVar+mm] = solDOFsElem[i*nVar+mm];
     }
 
-    /* Call the general function to carry out the matrix product to determine
-       the solution and gradients in the integration points of the chunk
-       of elements. */
-    blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
+    /* Determine the solution and gradients in the integration points of the
+       chunk of elements. Sum factorization is used for quadrilaterals and
+       hexahedra. */
+    standardElementsSol[ind].DataAndDerivativesIntegrationPoints(NPad, solDOFs, solAndGradInt,
+                                                                 workSumFact, blasFunctions, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the total fluxes (inviscid fluxes minus the      ---*/
@@ -3344,9 +3345,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = GetFluidModel()->GetPressure();
+            const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -3537,9 +3538,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy + dwdz;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = GetFluidModel()->GetPressure();
+            const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -3703,16 +3704,18 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Integrate the fluxes against the derivatives of the basis functions.
+       Use solDOFs as a temporary storage for the result. */
+    standardElementsSol[ind].IntegrateFluxesIntegrationPoints(NPad, fluxes, solDOFs, workSumFact,
+                                                              blasFunctions, config);
 
     /* Add the contribution from the source terms, if needed. Use solAndGradInt
-       as temporary storage for the matrix product. */
+       as temporary storage for the integration. */
     if( addSourceTerms ) {
 
-      /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
+      /* Integrate the source terms against the basis functions. */
+      standardElementsSol[ind].IntegrateDataIntegrationPoints(NPad, sources, solAndGradInt, workSumFact,
+                                                              blasFunctions, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -4362,8 +4365,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_2D(const su2double *sol
   const su2double divVel = dudx + dvdy;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -4458,8 +4461,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_3D(const su2double *sol
   const su2double divVel = dudx + dvdy + dwdz;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -6340,10 +6343,10 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
         su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-        FluidModel->SetTDState_rhoe(solInt[0], eInt);
-        const su2double Pressure = FluidModel->GetPressure();
-        const su2double Temperature = FluidModel->GetTemperature();
-        const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+        GetFluidModel()->SetTDState_rhoe(solInt[0], eInt);
+        const su2double Pressure = GetFluidModel()->GetPressure();
+        const su2double Temperature = GetFluidModel()->GetTemperature();
+        const su2double LaminarViscosity= GetFluidModel()->GetLaminarViscosity();
 
         /* Subtract the prescribed wall velocity, i.e. grid velocity
            from the velocity in the exchange point. */
@@ -6370,7 +6373,7 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         wallModel->WallShearStressAndHeatFlux(Temperature, velTan, LaminarViscosity, Pressure,
                                               Wall_HeatFlux, HeatFlux_Prescribed,
                                               Wall_Temperature, Temperature_Prescribed,
-                                              FluidModel, tauWall, qWall, ViscosityWall,
+                                              GetFluidModel(), tauWall, qWall, ViscosityWall,
                                               kOverCvWall);
 
         /* Compute the wall velocity in tangential direction. */
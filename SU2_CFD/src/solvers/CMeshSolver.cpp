@@ -619,6 +619,7 @@ void CMeshSolver::UpdateMultiGrid(CGeometry **geometry, CConfig *config) const{
     geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
     geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine],UPDATE);
     geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    geometry[iMGlevel]->SetHaloControlVolume(config);
     if (time_domain)
       geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine], config);
   }
@@ -1355,13 +1355,19 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
                   }
                 }
 
-                Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+                /*--- The Jacobian is only modified when it is being assembled, i.e. not
+                 when it is reused from a previous iteration (the time integration is
+                 then temporarily explicit, see CMultiGridIntegration). ---*/
+
+                const bool assemble = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+                if (assemble) Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
 
                 if (iPeriodic == val_periodic_index + nPeriodic/2) {
                   for (iVar = 0; iVar < nVar; iVar++) {
                     LinSysRes(iPoint, iVar) = 0.0;
                     total_index = iPoint*nVar+iVar;
-                    Jacobian.DeleteValsRowi(total_index);
+                    if (assemble) Jacobian.DeleteValsRowi(total_index);
                   }
                 }
 
@@ -2016,6 +2022,18 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
 }
 
+void CSolver::ReportJacobianMemory() const {
+
+  unsigned long localBytes = Jacobian.GetMemoryFootprint(), globalBytes = 0;
+  SU2_MPI::Allreduce(&localBytes, &globalBytes, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  if (rank == MASTER_NODE) {
+    cout << "Jacobian and preconditioner memory: " << globalBytes / 1048576.0 << " MB";
+    if (Jacobian.GetILUInPlace()) cout << " (in-place ILU)";
+    cout << "." << endl;
+  }
+}
+
 void CSolver::ResetCFLAdapt() {
   NonLinRes_Series.clear();
   NonLinRes_Value = 0;
@@ -2197,7 +2215,7 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
       CFL *= CFLFactor;
       solverFlow->GetNodes()->SetLocalCFL(iPoint, CFL);
-      if ((iMesh == MESH_0) && (config->GetKind_Turb_Model() != NONE)) {
+      if (((iMesh == MESH_0) || config->GetMultigrid_Turb()) && (config->GetKind_Turb_Model() != NONE)) {
         solverTurb->GetNodes()->SetLocalCFL(iPoint, CFL);
       }
 
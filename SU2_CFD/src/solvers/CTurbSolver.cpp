@@ -92,7 +92,8 @@ CTurbSolver::~CTurbSolver(void) {
 void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                   CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  const bool muscl = config->GetMUSCL_Turb();
+  /*--- The coarse levels of the multigrid are first order, as for the flow. ---*/
+  const bool muscl = config->GetMUSCL_Turb() && ((iMesh == MESH_0) || !config->GetMultigrid_Turb());
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER);
 
   /*--- Only reconstruct flow variables if MUSCL is on for flow (requires upwind) and turbulence. ---*/
@@ -514,6 +515,7 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
 
   const bool adjoint = config->GetContinuous_Adjoint() || (config->GetDiscrete_Adjoint() && config->GetFrozen_Visc_Disc());
   const bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
+  const bool multigrid = config->GetMultigrid_Turb();
 
   CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
@@ -545,10 +547,12 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
     su2double Delta = Vol / ((nodes->GetLocalCFL(iPoint)/flowNodes->GetLocalCFL(iPoint))*flowNodes->GetDelta_Time(iPoint));
     Jacobian.AddVal2Diag(iPoint, Delta);
 
-    /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
+    /*--- Right hand side of the system (-Residual, plus the forcing term of the multigrid)
+     *    and initial guess (x = 0) ---*/
 
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
       unsigned long total_index = iPoint*nVar + iVar;
+      if (multigrid) LinSysRes[total_index] += nodes->GetResTruncError(iPoint)[iVar];
       LinSysRes[total_index] = -LinSysRes[total_index];
       LinSysSol[total_index] = 0.0;
 
@@ -36,7 +36,8 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
                    (config->GetTime_Marching() == DT_STEPPING_2ND);
   bool viscous   = config->GetViscous();
   bool windgust  = config->GetWind_Gust();
-  bool classical_rk4 = (config->GetKind_TimeIntScheme_Flow() == CLASSICAL_RK4_EXPLICIT);
+  bool classical_rk4 = (config->GetKind_TimeIntScheme_Flow() == CLASSICAL_RK4_EXPLICIT) ||
+                       (config->GetKind_TimeIntScheme_Flow() == LOW_STORAGE_RK_EXPLICIT);
 
   /*--- Allocate and initialize the primitive variables and gradients ---*/
 
@@ -49,10 +50,10 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
 
   Res_TruncError.resize(nPoint,nVar) = su2double(0.0);
 
-  /*--- Only for residual smoothing (multigrid) ---*/
+  /*--- Only for residual smoothing (multigrid corrections and explicit schemes) ---*/
 
   for (unsigned long iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
-    if (config->GetMG_CorrecSmooth(iMesh) > 0) {
+    if ((config->GetMG_CorrecSmooth(iMesh) > 0) || (config->GetResSmoothing_Coeff() > 0.0)) {
       Residual_Sum.resize(nPoint,nVar);
       Residual_Old.resize(nPoint,nVar);
       break;
@@ -84,7 +85,7 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
 
   Solution_Old = Solution;
 
-  /*--- New solution initialization for Classical RK4 ---*/
+  /*--- New solution initialization for Classical RK4 (and low-storage RK) ---*/
 
   if (classical_rk4) Solution_New = Solution;
 
@@ -38,6 +38,20 @@ CTurbVariable::CTurbVariable(unsigned long npoint, unsigned long ndim, unsigned
     HB_Source.resize(nPoint,nVar) = su2double(0.0);
   }
 
+  /*--- Truncation error and residual smoothing of the multigrid ---*/
+
+  if (config->GetMultigrid_Turb()) {
+    Res_TruncError.resize(nPoint,nVar) = su2double(0.0);
+
+    for (unsigned long iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      if (config->GetMG_CorrecSmooth(iMesh) > 0) {
+        Residual_Sum.resize(nPoint,nVar);
+        Residual_Old.resize(nPoint,nVar);
+        break;
+      }
+    }
+  }
+
   /*--- Gradient related fields ---*/
 
   Gradient.resize(nPoint,nVar,nDim,0.0);
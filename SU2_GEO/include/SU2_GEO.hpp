@@ -42,3 +42,17 @@
 #include "../../../Common/include/grid_movement/CFreeFormDefBox.hpp"
 
 using namespace std;
+
+/*!
+ * \brief Gradient of the geometrical functions using algorithmic differentiation (AD).
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] surface_movement - Surface movement class of the problem.
+ * \param[in] nPlane - Number of sections.
+ * \param[in] Plane_P0 - Points of the section planes.
+ * \param[in] Plane_Normal - Normals of the section planes.
+ * \param[out] GeoGradient - Gradient of each function (in the order of the gradient file) per design variable.
+ */
+void SetGeoGradient_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement,
+                       unsigned short nPlane, su2double **Plane_P0, su2double **Plane_Normal,
+                       vector<vector<passivedouble> > &GeoGradient);
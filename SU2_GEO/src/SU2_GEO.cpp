@@ -596,8 +596,13 @@ int main(int argc, char *argv[]) {
     FFDBox = new CFreeFormDefBox*[MAX_NUMBER_FFD];
     for (iFFDBox = 0; iFFDBox < MAX_NUMBER_FFD; iFFDBox++) FFDBox[iFFDBox] = nullptr;
     
+#ifdef CODI_REVERSE_TYPE
+    if (rank == MASTER_NODE)
+      cout << endl << endl << "------------ Gradient evaluation using algorithmic differentiation ------" << endl;
+#else
     if (rank == MASTER_NODE)
       cout << endl << endl << "------------- Gradient evaluation using finite differences --------------" << endl;
+#endif
     
     /*--- Write the gradient in a external file ---*/
     if (rank == MASTER_NODE) {
@@ -608,9 +613,22 @@ int main(int argc, char *argv[]) {
       else filename += ".csv";
       Gradient_file.open(filename.c_str(), ios::out);
     }
-    
+
+#ifdef CODI_REVERSE_TYPE
+
+    /*--- The deformation and the evaluation of all the functions are recorded once,
+     instead of deforming and re-slicing the surface once per design variable. ---*/
+
+    vector<vector<passivedouble> > GeoGradient;
+    SetGeoGradient_AD(geometry_container[ZONE_0], config_container[ZONE_0], surface_movement,
+                      nPlane, Plane_P0, Plane_Normal, GeoGradient);
+#endif
+
     for (iDV = 0; iDV < config_container[ZONE_0]->GetnDV(); iDV++) {
 			   
+#ifdef CODI_REVERSE_TYPE
+      MoveSurface = true;
+#else
       /*--- Free Form deformation based ---*/
       
       if ((config_container[ZONE_0]->GetDesign_Variable(iDV) == FFD_CONTROL_POINT_2D) ||
@@ -846,10 +864,65 @@ int main(int argc, char *argv[]) {
         
       }
       
+#endif
+
       /*--- Compute gradient ---*/
       
       if (rank == MASTER_NODE) {
         
+#ifdef CODI_REVERSE_TYPE
+
+        /*--- Unpack the gradients, same order as in the gradient file. ---*/
+
+        const vector<passivedouble>& Grad_AD = GeoGradient[iDV];
+        unsigned short iFunc = 0;
+
+        if (geometry_container[ZONE_0]->GetnDim() == 3) {
+          if (config_container[ZONE_0]->GetGeo_Description() == FUSELAGE) {
+            Fuselage_Volume_Grad            = Grad_AD[iFunc++];
+            Fuselage_WettedArea_Grad        = Grad_AD[iFunc++];
+            Fuselage_MinWidth_Grad          = Grad_AD[iFunc++];
+            Fuselage_MaxWidth_Grad          = Grad_AD[iFunc++];
+            Fuselage_MinWaterLineWidth_Grad = Grad_AD[iFunc++];
+            Fuselage_MaxWaterLineWidth_Grad = Grad_AD[iFunc++];
+            Fuselage_MinHeight_Grad         = Grad_AD[iFunc++];
+            Fuselage_MaxHeight_Grad         = Grad_AD[iFunc++];
+            Fuselage_MaxCurvature_Grad      = Grad_AD[iFunc++];
+          }
+          else if (config_container[ZONE_0]->GetGeo_Description() == NACELLE) {
+            Nacelle_Volume_Grad          = Grad_AD[iFunc++];
+            Nacelle_MinThickness_Grad    = Grad_AD[iFunc++];
+            Nacelle_MaxThickness_Grad    = Grad_AD[iFunc++];
+            Nacelle_MinChord_Grad        = Grad_AD[iFunc++];
+            Nacelle_MaxChord_Grad        = Grad_AD[iFunc++];
+            Nacelle_MinLERadius_Grad     = Grad_AD[iFunc++];
+            Nacelle_MaxLERadius_Grad     = Grad_AD[iFunc++];
+            Nacelle_MinToC_Grad          = Grad_AD[iFunc++];
+            Nacelle_MaxToC_Grad          = Grad_AD[iFunc++];
+            Nacelle_ObjFun_MinToC_Grad   = Grad_AD[iFunc++];
+            Nacelle_MaxTwist_Grad        = Grad_AD[iFunc++];
+          }
+          else {
+            Wing_Volume_Grad          = Grad_AD[iFunc++];
+            Wing_MinThickness_Grad    = Grad_AD[iFunc++];
+            Wing_MaxThickness_Grad    = Grad_AD[iFunc++];
+            Wing_MinChord_Grad        = Grad_AD[iFunc++];
+            Wing_MaxChord_Grad        = Grad_AD[iFunc++];
+            Wing_MinLERadius_Grad     = Grad_AD[iFunc++];
+            Wing_MaxLERadius_Grad     = Grad_AD[iFunc++];
+            Wing_MinToC_Grad          = Grad_AD[iFunc++];
+            Wing_MaxToC_Grad          = Grad_AD[iFunc++];
+            Wing_ObjFun_MinToC_Grad   = Grad_AD[iFunc++];
+            Wing_MaxTwist_Grad        = Grad_AD[iFunc++];
+            Wing_MaxCurvature_Grad    = Grad_AD[iFunc++];
+            Wing_MaxDihedral_Grad     = Grad_AD[iFunc++];
+          }
+        }
+
+        for (iVar = 0; iFunc+iVar < Grad_AD.size(); iVar++)
+          Gradient[iVar] = Grad_AD[iFunc+iVar];
+
+#else
         delta_eps = config_container[ZONE_0]->GetDV_Value(iDV);
         
         if (delta_eps == 0) {
@@ -1041,6 +1114,8 @@ int main(int argc, char *argv[]) {
           
         }
         
+#endif
+
         /*--- Screen output ---*/
         
         if (config_container[ZONE_0]->GetGeo_Description() == FUSELAGE) {
@@ -1305,3 +1380,147 @@ int main(int argc, char *argv[]) {
   return EXIT_SUCCESS;
   
 }
+
+void SetGeoGradient_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement,
+                       unsigned short nPlane, su2double **Plane_P0, su2double **Plane_Normal,
+                       vector<vector<passivedouble> > &GeoGradient) {
+
+  unsigned short iDV, nDV, iDV_Value, nDV_Value, iPlane;
+  su2double DV_Value;
+  passivedouble my_Gradient, localGradient;
+
+  int rank = SU2_MPI::GetRank();
+
+  nDV = config->GetnDV();
+
+  const bool fuselage = (config->GetGeo_Description() == FUSELAGE);
+  const bool nacelle = (config->GetGeo_Description() == NACELLE);
+
+  if (rank == MASTER_NODE)
+    cout << endl << "Evaluate the geometrical functions gradient using Algorithmic Differentiation." << endl;
+
+  /*--- The gradient is projected on the direction of the finite difference step
+   (DV_VALUE) to keep the meaning of the gradient file of the finite difference mode. ---*/
+
+  vector<vector<passivedouble> > Direction(nDV);
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    if (config->GetDV_Value(iDV) == 0.0)
+      SU2_MPI::Error("The finite difference steps is zero!!", CURRENT_FUNCTION);
+
+    nDV_Value = config->GetnDV_Value(iDV);
+    for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++)
+      Direction[iDV].push_back(SU2_TYPE::GetValue(config->GetDV_Value(iDV, iDV_Value) / config->GetDV_Value(iDV)));
+  }
+
+  /*--- Start recording of operations ---*/
+
+  AD::StartRecording();
+
+  /*--- Register design variables as input and set them to zero
+   (the derivative is evaluated for the current design) ---*/
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    nDV_Value = config->GetnDV_Value(iDV);
+    for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++) {
+      DV_Value = 0.0;
+      AD::RegisterInput(DV_Value);
+      config->SetDV_Value(iDV, iDV_Value, DV_Value);
+    }
+  }
+
+  /*--- Call the surface deformation routine ---*/
+
+  surface_movement->SetSurface_Deformation(geometry, config);
+
+  /*--- Evaluate all the functions on the deformed surface, in the order of the gradient file. ---*/
+
+  vector<su2double> Functions;
+
+  if (geometry->GetnDim() == 3) {
+    if (fuselage) {
+      su2double Val[9];
+      geometry->Compute_Fuselage(config, false, Val[0], Val[1], Val[2], Val[3], Val[4], Val[5], Val[6], Val[7], Val[8]);
+      Functions.assign(Val, Val+9);
+    }
+    else if (nacelle) {
+      su2double Val[11];
+      geometry->Compute_Nacelle(config, false, Val[0], Val[1], Val[2], Val[3], Val[4], Val[5], Val[6], Val[7], Val[8], Val[9], Val[10]);
+      Functions.assign(Val, Val+11);
+    }
+    else {
+      su2double Val[13];
+      geometry->Compute_Wing(config, false, Val[0], Val[1], Val[2], Val[3], Val[4], Val[5], Val[6], Val[7], Val[8], Val[9], Val[10], Val[11], Val[12]);
+      Functions.assign(Val, Val+13);
+    }
+  }
+
+  const unsigned long nScalar = Functions.size();
+  const unsigned short nSectionFunc = fuselage? 5 : 6;
+  Functions.resize(nScalar + nSectionFunc*nPlane, 0.0);
+  su2double *SectionFunc = &Functions[nScalar];
+
+  vector<su2double> Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil;
+
+  for (iPlane = 0; iPlane < nPlane; iPlane++) {
+
+    geometry->ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, nullptr,
+                                     Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil, false, config);
+
+    if (Xcoord_Airfoil.size() <= 1) continue;
+
+    if (fuselage) {
+      SectionFunc[0*nPlane + iPlane] = geometry->Compute_Area(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+      SectionFunc[1*nPlane + iPlane] = geometry->Compute_Length(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+      SectionFunc[2*nPlane + iPlane] = geometry->Compute_Width(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+      SectionFunc[3*nPlane + iPlane] = geometry->Compute_WaterLineWidth(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+      SectionFunc[4*nPlane + iPlane] = geometry->Compute_Height(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+    }
+    else {
+      SectionFunc[0*nPlane + iPlane] = geometry->Compute_Area(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+      SectionFunc[1*nPlane + iPlane] = geometry->Compute_MaxThickness(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+      SectionFunc[2*nPlane + iPlane] = geometry->Compute_Chord(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+      SectionFunc[3*nPlane + iPlane] = geometry->Compute_LERadius(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+      SectionFunc[4*nPlane + iPlane] = SectionFunc[1*nPlane + iPlane] / SectionFunc[2*nPlane + iPlane];
+      SectionFunc[5*nPlane + iPlane] = geometry->Compute_Twist(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+    }
+  }
+
+  for (auto& Func : Functions) AD::RegisterOutput(Func);
+
+  /*--- Stop the recording --- */
+
+  AD::StopRecording();
+
+  /*--- One reverse sweep per function, the sections are gathered on all ranks,
+   the master seeds the functions and the contributions of each rank are summed. ---*/
+
+  GeoGradient.assign(nDV, vector<passivedouble>(Functions.size(), 0.0));
+
+  for (unsigned long iFunc = 0; iFunc < Functions.size(); iFunc++) {
+
+    AD::ClearAdjoints();
+
+    if (rank == MASTER_NODE) SU2_TYPE::SetDerivative(Functions[iFunc], 1.0);
+
+    AD::ComputeAdjoint();
+
+    for (iDV = 0; iDV < nDV; iDV++) {
+      my_Gradient = 0.0;
+      nDV_Value = config->GetnDV_Value(iDV);
+      for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++) {
+        DV_Value = config->GetDV_Value(iDV, iDV_Value);
+        my_Gradient += SU2_TYPE::GetDerivative(DV_Value) * Direction[iDV][iDV_Value];
+      }
+#ifdef HAVE_MPI
+      SelectMPIWrapper<passivedouble>::W::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+      localGradient = my_Gradient;
+#endif
+      GeoGradient[iDV][iFunc] = localGradient;
+    }
+  }
+
+  AD::Reset();
+
+}
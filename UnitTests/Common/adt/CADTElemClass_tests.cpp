@@ -0,0 +1,138 @@
+/*!
+ * \file CADTElemClass_tests.cpp
+ * \brief Unit tests for the nearest element searches of the element ADT.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/adt/CADTElemClass.hpp"
+#include "../../../Common/include/option_structure.hpp"
+
+TEST_CASE("ADT nearest elements", "[ADT]") {
+
+  /*--- Wavy surface of quadrilaterals and triangles (cells split in two). ---*/
+  const unsigned short nDim = 3;
+  const unsigned long nx = 20, ny = 15;
+
+  vector<su2double> coor;
+  for (auto j = 0ul; j <= ny; ++j) {
+    for (auto i = 0ul; i <= nx; ++i) {
+      const su2double x = su2double(i)/nx, y = su2double(j)/ny;
+      coor.push_back(x);
+      coor.push_back(y);
+      coor.push_back(0.2*sin(3.0*x)*cos(2.0*y));
+    }
+  }
+
+  vector<unsigned long> conn, elemIDs;
+  vector<unsigned short> types, markers;
+  for (auto j = 0ul; j < ny; ++j) {
+    for (auto i = 0ul; i < nx; ++i) {
+      const unsigned long n0 = j*(nx+1)+i, n1 = n0+1, n2 = n1+nx+1, n3 = n0+nx+1;
+      if ((i+j)%3 == 0) {
+        conn.insert(conn.end(), {n0, n1, n2, n3});
+        types.push_back(QUADRILATERAL);
+      }
+      else {
+        conn.insert(conn.end(), {n0, n1, n2, n0, n2, n3});
+        types.insert(types.end(), {TRIANGLE, TRIANGLE});
+      }
+    }
+  }
+  markers.resize(types.size(), 0);
+  for (auto i = 0ul; i < types.size(); ++i) elemIDs.push_back(i);
+
+  CADTElemClass adt(nDim, coor, conn, types, markers, elemIDs, false);
+
+  /*--- Query points around the surface, the batched search is compared
+   * with single searches and with the brute force minimum distance. ---*/
+  const unsigned long nPoints = 500;
+  su2activematrix points(nPoints, nDim);
+  for (auto i = 0ul; i < nPoints; ++i) {
+    points(i,0) = -0.2 + 1.4*((37*i)%101)/100.0;
+    points(i,1) = -0.2 + 1.4*((53*i)%89)/88.0;
+    points(i,2) = -0.5 + ((17*i)%61)/60.0;
+  }
+
+  vector<unsigned long> iElemADT;
+  vector<su2double> dist;
+  vector<unsigned short> markerID;
+  vector<unsigned long> elemID;
+  vector<int> rankID;
+
+  adt.DetermineNearestElements(points, iElemADT, dist, markerID, elemID, rankID);
+
+  REQUIRE(dist.size() == nPoints);
+
+  for (auto i = 0ul; i < nPoints; ++i) {
+    su2double distSingle;
+    unsigned short marker;
+    unsigned long elem;
+    int rank;
+    adt.DetermineNearestElement(points[i], distSingle, marker, elem, rank);
+
+    su2double distBrute = 1e300;
+    for (auto iElem = 0ul; iElem < adt.GetnElem(); ++iElem) {
+      su2double d;
+      adt.DistanceToElement(points[i], iElem, d, marker, elem, rank);
+      distBrute = min(distBrute, d);
+    }
+
+    /*--- The selected element must be a nearest one, in ties it may differ
+     * from the one of the single search. ---*/
+    su2double distSelected;
+    adt.DistanceToElement(points[i], iElemADT[i], distSelected, marker, elem, rank);
+
+    CHECK(dist[i] == Approx(distSingle).margin(1e-12));
+    CHECK(dist[i] == Approx(distBrute).margin(1e-12));
+    CHECK(distSelected == Approx(distBrute).margin(1e-12));
+    CHECK(elemID[i] == iElemADT[i]);
+  }
+
+  /*--- Points above the nodes, many quadrilaterals and triangles are at the same distance. ---*/
+  su2activematrix nodePoints(coor.size()/nDim, nDim);
+  for (auto i = 0ul; i < nodePoints.rows(); ++i)
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      nodePoints(i,iDim) = coor[i*nDim+iDim] + (iDim == 2? 0.05 : 0.0);
+
+  vector<su2double> distNodes;
+  iElemADT.clear();
+  adt.DetermineNearestElements(nodePoints, iElemADT, distNodes, markerID, elemID, rankID);
+
+  for (auto i = 0ul; i < nodePoints.rows(); ++i) {
+    su2double distSingle;
+    unsigned short marker;
+    unsigned long elem;
+    int rank;
+    adt.DetermineNearestElement(nodePoints[i], distSingle, marker, elem, rank);
+    CHECK(distNodes[i] == Approx(distSingle).margin(1e-12));
+  }
+
+  /*--- The result is also obtained from (poor) initial guesses. ---*/
+  vector<su2double> dist2;
+  for (auto& iElem : iElemADT) iElem = (iElem*7) % adt.GetnElem();
+  adt.DetermineNearestElements(points, iElemADT, dist2, markerID, elemID, rankID);
+
+  for (auto i = 0ul; i < nPoints; ++i)
+    CHECK(dist2[i] == Approx(dist[i]).margin(1e-12));
+}
@@ -0,0 +1,91 @@
+/*!
+ * \file CADTPointsOnlyClass_tests.cpp
+ * \brief Unit tests for the nearest node searches of the points-only ADT.
+ * \author E. van der Weide
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
+#include <algorithm>
+#include <numeric>
+
+TEST_CASE("ADT k nearest nodes", "[ADT]") {
+
+  /*--- Points on a perturbed 3D lattice, with duplicated coordinates
+   * to check the tie-breaking by point ID. ---*/
+  const unsigned short nDim = 3;
+  const unsigned long nPoints = 1000;
+
+  vector<su2double> coor(nDim*nPoints);
+  for (auto i = 0ul; i < nPoints; ++i) {
+    const auto j = (i < nPoints/2)? i : i - nPoints/2;
+    coor[nDim*i+0] = su2double(j%10) + 0.01*((7*j)%13);
+    coor[nDim*i+1] = su2double((j/10)%10) + 0.01*((5*j)%11);
+    coor[nDim*i+2] = su2double(j/100) + 0.01*((3*j)%7);
+  }
+
+  vector<unsigned long> pointID(nPoints);
+  iota(pointID.begin(), pointID.end(), 0ul);
+
+  CADTPointsOnlyClass adt(nDim, nPoints, coor.data(), pointID.data(), false);
+
+  vector<su2double> dist;
+  vector<unsigned long> ids;
+  vector<int> ranks;
+
+  const su2double targets[][3] = {{0.0, 0.0, 0.0}, {4.53, 2.21, 3.9}, {9.9, -1.0, 12.0}, {5.0, 5.0, 2.0}};
+
+  for (const auto& target : targets) {
+
+    /*--- Reference by brute force. ---*/
+    vector<unsigned long> order(nPoints);
+    iota(order.begin(), order.end(), 0ul);
+    vector<su2double> d2(nPoints, 0.0);
+    for (auto i = 0ul; i < nPoints; ++i)
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        d2[i] += pow(target[iDim] - coor[nDim*i+iDim], 2);
+    stable_sort(order.begin(), order.end(), [&](unsigned long a, unsigned long b) { return d2[a] < d2[b]; });
+
+    for (auto nNodes : {1ul, 4ul, 17ul}) {
+      adt.DetermineNearestNodes(target, nNodes, dist, ids, ranks);
+
+      REQUIRE(ids.size() == nNodes);
+      for (auto i = 0ul; i < nNodes; ++i) {
+        CHECK(ids[i] == order[i]);
+        CHECK(dist[i] == Approx(sqrt(d2[order[i]])));
+      }
+    }
+
+    /*--- The single nearest node search must agree. ---*/
+    su2double dist0;
+    unsigned long id0;
+    int rank0;
+    adt.DetermineNearestNode(target, dist0, id0, rank0);
+    CHECK(dist0 == Approx(sqrt(d2[order[0]])));
+  }
+
+  /*--- Asking for more nodes than available returns all of them. ---*/
+  adt.DetermineNearestNodes(targets[1], 2*nPoints, dist, ids, ranks);
+  CHECK(ids.size() == nPoints);
+}
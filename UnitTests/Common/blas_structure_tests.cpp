@@ -0,0 +1,61 @@
+/*!
+ * \file blas_structure_tests.cpp
+ * \brief Unit tests for the native matrix multiplication kernels.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/CConfig.hpp"
+#include "../../Common/include/blas_structure.hpp"
+
+TEST_CASE("GEMM small shapes", "[BLAS]") {
+
+  CBlasStructure blas;
+
+  /*--- Shapes typical for DG, i.e. a batch of elements in the columns of B,
+   * including ragged sizes that exercise the remainder paths. ---*/
+  const int Ms[] = {1, 3, 8, 27};
+  const int Ns[] = {1, 5, 8, 24, 40, 43};
+  const int Ks[] = {1, 4, 27, 200};
+
+  for (int M : Ms) {
+    for (int N : Ns) {
+      for (int K : Ks) {
+
+        vector<su2double> A(M*K), B(K*N), C(M*N, -1.0);
+        for (int i = 0; i < M*K; ++i) A[i] = 0.5 + (i%7) - 0.1*(i%5);
+        for (int i = 0; i < K*N; ++i) B[i] = 1.0 - 0.3*(i%11) + 0.01*i;
+
+        blas.gemm(M, N, K, A.data(), B.data(), C.data(), nullptr);
+
+        for (int i = 0; i < M; ++i) {
+          for (int j = 0; j < N; ++j) {
+            su2double ref = 0.0;
+            for (int p = 0; p < K; ++p) ref += A[i*K+p] * B[p*N+j];
+            CHECK(SU2_TYPE::GetValue(C[i*N+j]) == Approx(SU2_TYPE::GetValue(ref)));
+          }
+        }
+      }
+    }
+  }
+}
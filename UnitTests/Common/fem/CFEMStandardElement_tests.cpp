@@ -0,0 +1,103 @@
+/*!
+ * \file CFEMStandardElement_tests.cpp
+ * \brief Unit tests for the sum factorization of the FEM standard elements.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/fem/fem_standard_element.hpp"
+#include "../../../Common/include/blas_structure.hpp"
+
+namespace {
+
+/*--- Check the sum factorized products against the dense matrices. ---*/
+void CheckSumFactorization(unsigned short VTK_Type, unsigned short nPoly, unsigned short orderExact) {
+
+  /*--- The integration order is given, such that no config is needed. ---*/
+  const CFEMStandardElement elem(VTK_Type, nPoly, false, nullptr, orderExact);
+  REQUIRE(elem.GetSumFactorization());
+
+  CBlasStructure blas;
+  const unsigned short nDimPar = (VTK_Type == HEXAHEDRON) ? 3 : 2;
+  const int nDOFs = elem.GetNDOFs(), nInt = elem.GetNIntegration(), N = 7;
+
+  vector<su2double> work(N*elem.GetSizeWorkSumFactorization());
+  vector<su2double> dataDOFs(nDOFs*N), dataInt(nInt*N*nDimPar);
+  for (int i = 0; i < nDOFs*N; ++i) dataDOFs[i] = 1.0 + 0.1*(i%13) - 0.01*i;
+  for (int i = 0; i < nInt*N*nDimPar; ++i) dataInt[i] = 0.5 - 0.2*(i%7) + 0.003*i;
+
+  auto compare = [](const vector<su2double>& a, const vector<su2double>& b) {
+    REQUIRE(a.size() == b.size());
+    for (size_t i = 0; i < a.size(); ++i)
+      CHECK(SU2_TYPE::GetValue(a[i]) == Approx(SU2_TYPE::GetValue(b[i])).margin(1e-12));
+  };
+
+  /*--- Solution and its derivatives in the integration points. ---*/
+  vector<su2double> ref(nInt*N*(nDimPar+1)), res(nInt*N*(nDimPar+1));
+  blas.gemm(nInt*(nDimPar+1), N, nDOFs, elem.GetMatBasisFunctionsIntegration(),
+            dataDOFs.data(), ref.data(), nullptr);
+  elem.DataAndDerivativesIntegrationPoints(N, dataDOFs.data(), res.data(),
+                                           work.data(), &blas, nullptr);
+  compare(res, ref);
+
+  res.resize(nInt*N);
+  ref.resize(nInt*N);
+  elem.InterpolateDOFsToIntegrationPoints(N, dataDOFs.data(), res.data(),
+                                          work.data(), &blas, nullptr);
+  compare(res, ref);
+
+  /*--- Integration of data and of fluxes against the basis functions. ---*/
+  ref.resize(nDOFs*N);
+  res.resize(nDOFs*N);
+  blas.gemm(nDOFs, N, nInt, elem.GetBasisFunctionsIntegrationTrans(),
+            dataInt.data(), ref.data(), nullptr);
+  elem.IntegrateDataIntegrationPoints(N, dataInt.data(), res.data(),
+                                      work.data(), &blas, nullptr);
+  compare(res, ref);
+
+  blas.gemm(nDOFs, N, nInt*nDimPar, elem.GetDerMatBasisFunctionsIntTrans(),
+            dataInt.data(), ref.data(), nullptr);
+  elem.IntegrateFluxesIntegrationPoints(N, dataInt.data(), res.data(),
+                                        work.data(), &blas, nullptr);
+  compare(res, ref);
+}
+
+}
+
+TEST_CASE("Sum factorization quadrilateral", "[FEM]") {
+  CheckSumFactorization(QUADRILATERAL, 2, 4);
+  CheckSumFactorization(QUADRILATERAL, 5, 10);
+}
+
+TEST_CASE("Sum factorization hexahedron", "[FEM]") {
+  CheckSumFactorization(HEXAHEDRON, 2, 4);
+  CheckSumFactorization(HEXAHEDRON, 4, 8);
+}
+
+/*--- More integration points than DOFs per direction (non-square 1D matrices). ---*/
+TEST_CASE("Sum factorization over-integrated", "[FEM]") {
+  CheckSumFactorization(QUADRILATERAL, 2, 7);
+  CheckSumFactorization(QUADRILATERAL, 3, 11);
+  CheckSumFactorization(HEXAHEDRON, 2, 7);
+  CheckSumFactorization(HEXAHEDRON, 3, 9);
+}
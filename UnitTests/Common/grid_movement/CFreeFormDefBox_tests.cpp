@@ -0,0 +1,122 @@
+/*!
+ * \file CFreeFormDefBox_tests.cpp
+ * \brief Unit tests for the point inversion of the FFD boxes.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <sstream>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/grid_movement/CFreeFormDefBox.hpp"
+
+/*--- Distorted box (not a parallelepiped) with the given blending, the control points
+ * of the parallelepiped [0,2]x[0,1]x[0,1] are moved by a smooth invertible map. ---*/
+static void SetDistortedBox(CFreeFormDefBox& FFDBox) {
+
+  const su2double corners[8][3] = {{0,0,0}, {2,0,0}, {2,1,0}, {0,1,0},
+                                   {0,0,1}, {2,0,1}, {2,1,1}, {0,1,1}};
+  for (unsigned short iCorner = 0; iCorner < 8; iCorner++)
+    FFDBox.SetCoordCornerPoints(corners[iCorner], iCorner);
+
+  FFDBox.SetControlPoints_Parallelepiped();
+
+  for (unsigned short i = 0; i < FFDBox.GetlOrder(); i++)
+    for (unsigned short j = 0; j < FFDBox.GetmOrder(); j++)
+      for (unsigned short k = 0; k < FFDBox.GetnOrder(); k++) {
+        const su2double* coord = FFDBox.GetCoordControlPoints(i, j, k);
+        const su2double x = coord[0], y = coord[1], z = coord[2];
+        const su2double newCoord[3] = {x + 0.1*y*z, y + 0.15*sin(0.5*x)*z, z + 0.05*x*y};
+        FFDBox.SetCoordControlPoints(newCoord, i, j, k);
+      }
+}
+
+static void CheckBatchInversion(unsigned short kindBlending) {
+
+  stringstream ss(string("FFD_TOLERANCE= 1E-10\nFFD_ITERATIONS= 500\nFFD_BLENDING= ") +
+                  (kindBlending == BEZIER? "BEZIER\n" : "BSPLINE_UNIFORM\n"));
+  streambuf* orig_buf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  CConfig config(ss, SU2_DEF, false);
+  cout.rdbuf(orig_buf);
+
+  unsigned short degree[] = {3, 2, 2}, splineOrder[] = {3, 3, 3};
+  CFreeFormDefBox FFDBox(degree, splineOrder, kindBlending);
+  SetDistortedBox(FFDBox);
+
+  /*--- Points with known parametric coordinates, inside the box since the uniform
+   * B-Spline blending is not defined at the end of the last knot span. ---*/
+
+  const unsigned short n = 6;
+  su2activematrix exactUVW(n*n*n, 3), xyz(n*n*n, 3);
+  unsigned long iPoint = 0;
+  for (unsigned short i = 0; i < n; i++)
+    for (unsigned short j = 0; j < n; j++)
+      for (unsigned short k = 0; k < n; k++, iPoint++) {
+        su2double uvw[3] = {0.02+0.96*su2double(i)/(n-1), 0.05+0.9*su2double(j)/(n-1), 0.1+0.8*su2double(k)/(n-1)};
+        const su2double* coord = FFDBox.EvalCartesianCoord(uvw);
+        for (unsigned short iDim = 0; iDim < 3; iDim++) {
+          exactUVW(iPoint,iDim) = uvw[iDim];
+          xyz(iPoint,iDim) = coord[iDim];
+        }
+      }
+
+  /*--- Batched inversion from the lattice guesses. ---*/
+
+  su2activematrix batchUVW;
+  vector<char> converged;
+  const auto nFailed = FFDBox.GetParametricCoord_Batch(xyz, batchUVW, converged, false, &config);
+  CHECK(nFailed == 0);
+
+  /*--- Scalar inversion from the center of the box, it must find the same points. ---*/
+
+  const su2double guess[3] = {0.5, 0.5, 0.5};
+
+  for (iPoint = 0; iPoint < xyz.rows(); iPoint++) {
+    CHECK(converged[iPoint]);
+    /*--- Converged means the point is reached, not only that the steps became small. ---*/
+    const su2double* batchXYZ = FFDBox.EvalCartesianCoord(batchUVW[iPoint]);
+    for (unsigned short iDim = 0; iDim < 3; iDim++)
+      CHECK(batchXYZ[iDim] == Approx(xyz(iPoint,iDim)).margin(1e-10));
+    const su2double* scalarUVW = FFDBox.GetParametricCoord_Iterative(iPoint, xyz[iPoint], guess, &config);
+    for (unsigned short iDim = 0; iDim < 3; iDim++) {
+      CHECK(batchUVW(iPoint,iDim) == Approx(exactUVW(iPoint,iDim)).margin(1e-9));
+      CHECK(batchUVW(iPoint,iDim) == Approx(scalarUVW[iDim]).margin(1e-8));
+    }
+  }
+
+  /*--- Starting from the solution must keep it. ---*/
+
+  su2activematrix guessUVW = exactUVW;
+  CHECK(FFDBox.GetParametricCoord_Batch(xyz, guessUVW, converged, true, &config) == 0);
+  for (iPoint = 0; iPoint < xyz.rows(); iPoint++)
+    for (unsigned short iDim = 0; iDim < 3; iDim++)
+      CHECK(guessUVW(iPoint,iDim) == Approx(exactUVW(iPoint,iDim)).margin(1e-9));
+}
+
+TEST_CASE("FFD batched point inversion, Bezier", "[FFD]") {
+  CheckBatchInversion(BEZIER);
+}
+
+TEST_CASE("FFD batched point inversion, B-Spline", "[FFD]") {
+  CheckBatchInversion(BSPLINE_UNIFORM);
+}
@@ -0,0 +1,210 @@
+/*!
+ * \file CSysMatrix_tests.cpp
+ * \brief Unit tests for the preconditioners of the sparse matrix class.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <sstream>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+/*!
+ * \brief Box mesh and a block matrix with its sparse pattern, the values mimic a
+ * (diagonally dominant) upwind convection-diffusion operator.
+ */
+struct MatrixTestCase {
+  const string baseOptions;
+
+  static constexpr unsigned short nVar = 3;
+
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+
+  MatrixTestCase(const string& options = "MESH_BOX_SIZE= 7,6,5\nMESH_BOX_LENGTH= 1,1,1\n") :
+    baseOptions("SOLVER= EULER\n"
+                "MESH_FORMAT= BOX\n"
+                "INIT_OPTION= TD_CONDITIONS\n"
+                "MARKER_EULER= (y_minus, y_plus)\n"
+                "MARKER_FAR= (x_minus, x_plus, z_plus, z_minus)\n"
+                "MESH_BOX_OFFSET= 0,0,0\n" + options) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    stringstream ss(baseOptions);
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_CFD, false));
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->Check_IntElem_Orientation(config.get());
+    geometry->Check_BoundElem_Orientation(config.get());
+    geometry->SetEdges();
+    geometry->SetVertex(config.get());
+    geometry->SetCoord_CG();
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+    geometry->FindNormal_Neighbor(config.get());
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+
+    cout.rdbuf(origBuf);
+  }
+
+  /*!
+   * \brief Make a config with extra options (for the matrices) that uses the same mesh.
+   * \note The markers of this config are not set, only the main one can be used with the geometry.
+   */
+  std::unique_ptr<CConfig> MakeConfig(const string& options) const {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    stringstream ss(baseOptions + options);
+    auto cfg = std::unique_ptr<CConfig>(new CConfig(ss, SU2_CFD, false));
+    cout.rdbuf(origBuf);
+    return cfg;
+  }
+
+  /*!
+   * \brief Set the values of the matrix, the edges for which "skipEdge" is true are not coupled.
+   */
+  template<class F = bool(*)(unsigned long)>
+  void InitMatrix(CSysMatrix<su2double>& matrix, const CConfig* cfg,
+                  F skipEdge = [](unsigned long) { return false; }) const {
+
+    matrix.Initialize(geometry->GetnPoint(), geometry->GetnPointDomain(), nVar, nVar, true, geometry.get(), cfg);
+
+    su2double blockI[nVar*nVar], blockJ[nVar*nVar], diag[nVar*nVar];
+
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+      if (skipEdge(iEdge)) continue;
+      const auto iPoint = geometry->edges->GetNode(iEdge,0);
+      const auto jPoint = geometry->edges->GetNode(iEdge,1);
+      const su2double w = 1.0 + 0.3*sin(su2double(iEdge));
+
+      for (auto k = 0ul; k < nVar*nVar; ++k) {
+        blockI[k] = -w * (1.0 + 0.1*k);
+        blockJ[k] = -w * (0.4 + 0.05*k);
+      }
+      matrix.SetBlock(iPoint, jPoint, blockI);
+      matrix.SetBlock(jPoint, iPoint, blockJ);
+    }
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+      for (auto k = 0ul; k < nVar*nVar; ++k) diag[k] = 0.1*sin(su2double(iPoint+k));
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        diag[iVar*(nVar+1)] = 25.0 + cos(su2double(iPoint));
+      matrix.SetBlock(iPoint, iPoint, diag);
+    }
+  }
+};
+
+TEST_CASE("Level-scheduled ILU", "[LinearSolvers]") {
+
+  MatrixTestCase test;
+  const auto nPoint = test.geometry->GetnPoint();
+  const auto nPointDomain = test.geometry->GetnPointDomain();
+  const auto nVar = MatrixTestCase::nVar;
+
+  for (auto fill : {0, 1}) {
+
+    /*--- Reference, the sequential ILU (i.e. a single partition). ---*/
+    const string common = "LINEAR_SOLVER_PREC= ILU\nLINEAR_SOLVER_ILU_FILL_IN= " + to_string(fill) + "\n";
+    auto cfgRef = test.MakeConfig(common + "LINEAR_SOLVER_PREC_THREADS= 1\n");
+    auto cfgLevels = test.MakeConfig(common + "LINEAR_SOLVER_ILU_LEVEL_SCHEDULING= YES\n");
+
+    CSysMatrix<su2double> matRef, matLevels;
+    test.InitMatrix(matRef, cfgRef.get());
+    test.InitMatrix(matLevels, cfgLevels.get());
+
+    CSysVector<su2double> vec(nPoint, nPointDomain, nVar, 0.0), precRef(vec), precLevels(vec);
+    for (auto i = 0ul; i < nPointDomain*nVar; ++i) vec[i] = cos(0.3*i);
+
+    SU2_OMP_PARALLEL
+    {
+      matRef.BuildILUPreconditioner();
+      matRef.ComputeILUPreconditioner(vec, precRef, test.geometry.get(), cfgRef.get());
+
+      matLevels.BuildILUPreconditioner();
+      matLevels.ComputeILUPreconditioner(vec, precLevels, test.geometry.get(), cfgLevels.get());
+    }
+
+    /*--- Same operations on each row, in a different order. ---*/
+    for (auto i = 0ul; i < nPointDomain*nVar; ++i)
+      CHECK(precLevels[i] == Approx(precRef[i]).epsilon(1e-12));
+  }
+}
+
+TEST_CASE("Batched linelet solve", "[LinearSolvers]") {
+
+  /*--- Thin box, the linelets are normal to the walls (y). The seeds of the first wall grow
+   * up to the other wall (5 points), those of the second have only the wall point. With 15
+   * linelets of each length, one batch mixes both lengths and the last one is padded. ---*/
+  const unsigned long ny = 6;
+  MatrixTestCase test("MESH_BOX_SIZE= 5," + to_string(ny) + ",3\nMESH_BOX_LENGTH= 1,0.05,1\n"
+                      "LINEAR_SOLVER_PREC= LINELET\n");
+  auto& geometry = test.geometry;
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nVar = MatrixTestCase::nVar;
+  const su2double dy = 0.05 / (ny-1);
+
+  auto cfg = test.config.get();
+
+  /*--- Only the edges normal to the walls are coupled, except those of the wall points, then the
+   * matrix is block-tridiagonal (with unequal blocks) along the linelets and the batched solve
+   * must be its direct solution, whichever wall is processed first. ---*/
+  auto skipEdge = [&](unsigned long iEdge) {
+    const auto iCoord = geometry->nodes->GetCoord(geometry->edges->GetNode(iEdge,0));
+    const auto jCoord = geometry->nodes->GetCoord(geometry->edges->GetNode(iEdge,1));
+    if ((fabs(iCoord[0]-jCoord[0]) > 1e-8) || (fabs(iCoord[2]-jCoord[2]) > 1e-8)) return true;
+    const auto j = lround(SU2_TYPE::GetValue(min(iCoord[1], jCoord[1]) / dy));
+    return (j == 0) || (j == long(ny)-2);
+  };
+
+  CSysMatrix<su2double> matrix;
+  test.InitMatrix(matrix, cfg, skipEdge);
+
+  const auto avgPoints = matrix.BuildLineletPreconditioner(geometry.get(), cfg);
+  REQUIRE(avgPoints == (ny-1+1)/2);
+
+  CLineletPreconditioner<su2double> precond(matrix, geometry.get(), cfg);
+
+  CSysVector<su2double> vec(nPoint, nPointDomain, nVar, 0.0), prod(vec), res(vec);
+  for (auto i = 0ul; i < nPointDomain*nVar; ++i) vec[i] = cos(0.3*i);
+
+  SU2_OMP_PARALLEL
+  {
+    precond.Build();
+    precond(vec, prod);
+    matrix.ComputeResidual(prod, vec, res);
+  }
+
+  for (auto i = 0ul; i < nPointDomain*nVar; ++i)
+    CHECK(res[i] == Approx(0.0).margin(1e-12));
+}
@@ -0,0 +1,196 @@
+/*!
+ * \file CSysSolve_tests.cpp
+ * \brief Unit tests for the Krylov linear solvers.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <sstream>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+using Vector = CSysVector<su2double>;
+
+/*--- Tridiagonal matrix with variable diagonal, 3+sin(i), symmetric positive definite
+ * if lower == upper, and a convection-diffusion like operator otherwise. ---*/
+class CTridiagProduct final : public CMatrixVectorProduct<su2double> {
+public:
+  su2double lower, upper, shift = 0.0;
+
+  CTridiagProduct(su2double l, su2double u) : lower(l), upper(u) {}
+
+  su2double Diag(unsigned long i) const { return 3.0 + sin(su2double(i)) + shift; }
+
+  void operator()(const Vector& u, Vector& v) const override {
+    /*--- The vector operations do not synchronize the threads. ---*/
+    const auto n = u.GetLocSize();
+    SU2_OMP_BARRIER
+    SU2_OMP_FOR_STAT(64)
+    for (auto i = 0ul; i < n; ++i) {
+      v[i] = Diag(i) * u[i];
+      if (i > 0) v[i] += lower * u[i-1];
+      if (i+1 < n) v[i] += upper * u[i+1];
+    }
+  }
+};
+
+class CDiagPreconditioner final : public CPreconditioner<su2double> {
+  const CTridiagProduct& mat;
+public:
+  CDiagPreconditioner(const CTridiagProduct& m) : mat(m) {}
+
+  void operator()(const Vector& u, Vector& v) const override {
+    const auto n = u.GetLocSize();
+    SU2_OMP_BARRIER
+    SU2_OMP_FOR_STAT(64)
+    for (auto i = 0ul; i < n; ++i) v[i] = u[i] / mat.Diag(i);
+  }
+};
+
+using SolverFunc = unsigned long (CSysSolve<su2double>::*)(const Vector&, Vector&, const CMatrixVectorProduct<su2double>&,
+                                                          const CPreconditioner<su2double>&, su2double, unsigned long,
+                                                          su2double&, bool, const CConfig*) const;
+
+static CConfig* MakeConfig(unsigned long restart = 10, unsigned long recycle = 20) {
+  stringstream ss("SOLVER= EULER\nLINEAR_SOLVER_RESTART_FREQUENCY= " + to_string(restart) +
+                  "\nLINEAR_SOLVER_RECYCLE_SIZE= " + to_string(recycle) + "\n");
+  streambuf* orig_buf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  auto config = new CConfig(ss, SU2_CFD, false);
+  cout.rdbuf(orig_buf);
+  return config;
+}
+
+/*--- Solve A x = b from x = 0, with the threads of a parallel region, returns the iterations. ---*/
+static unsigned long Solve(const CSysSolve<su2double>& solver, SolverFunc func, const CTridiagProduct& mat,
+                           const Vector& b, Vector& x, unsigned long maxIter, const CConfig* config) {
+  CDiagPreconditioner precond(mat);
+  unsigned long iter = 0;
+  x = su2double(0.0);
+
+  SU2_OMP_PARALLEL
+  {
+    su2double residual = 0.0;
+    const auto it = (solver.*func)(b, x, mat, precond, 1e-10, maxIter, residual, false, config);
+    SU2_OMP_MASTER
+    iter = it;
+  }
+  return iter;
+}
+
+static void CheckSolution(const Vector& x, const Vector& xExact) {
+  for (auto i = 0ul; i < x.GetLocSize(); ++i)
+    CHECK(x[i] == Approx(xExact[i]).margin(1e-7));
+}
+
+TEST_CASE("Pipelined linear solvers", "[LinearSolvers]") {
+
+  const unsigned long n = 300;
+  auto config = MakeConfig();
+  CSysSolve<su2double> solver;
+
+  Vector xExact(n), b(n), x(n), xRef(n);
+  for (auto i = 0ul; i < n; ++i) xExact[i] = cos(0.1*i) + 0.01*i;
+
+  SECTION("CG") {
+    CTridiagProduct mat(-1.0, -1.0);
+    mat(xExact, b);
+
+    const auto iterRef = Solve(solver, &CSysSolve<su2double>::CG_LinSolver, mat, b, xRef, n, config);
+    const auto iter = Solve(solver, &CSysSolve<su2double>::PipelinedCG_LinSolver, mat, b, x, n, config);
+
+    CheckSolution(xRef, xExact);
+    CheckSolution(x, xExact);
+    /*--- Same method in exact arithmetic, the convergence check lags one iteration. ---*/
+    CHECK(iter <= iterRef+2);
+    CHECK(iter+2 >= iterRef);
+  }
+
+  SECTION("GMRES") {
+    CTridiagProduct mat(-1.4, -0.6);
+    mat(xExact, b);
+
+    const auto iterRef = Solve(solver, &CSysSolve<su2double>::FGMRES_LinSolver, mat, b, xRef, 100, config);
+    const auto iter = Solve(solver, &CSysSolve<su2double>::PipelinedGMRES_LinSolver, mat, b, x, 100, config);
+
+    CheckSolution(xRef, xExact);
+    CheckSolution(x, xExact);
+    CHECK(iter <= iterRef+2);
+    CHECK(iter+2 >= iterRef);
+  }
+
+  SECTION("BCGSTAB") {
+    CTridiagProduct mat(-1.4, -0.6);
+    mat(xExact, b);
+
+    const auto iterRef = Solve(solver, &CSysSolve<su2double>::BCGSTAB_LinSolver, mat, b, xRef, n, config);
+    const auto iter = Solve(solver, &CSysSolve<su2double>::PipelinedBCGSTAB_LinSolver, mat, b, x, n, config);
+
+    CheckSolution(xRef, xExact);
+    CheckSolution(x, xExact);
+    CHECK(iter <= iterRef+2);
+    CHECK(iter+2 >= iterRef);
+  }
+
+  delete config;
+}
+
+TEST_CASE("Recycling GCRO", "[LinearSolvers]") {
+
+  /*--- Sequence of slowly varying systems (matrix and rhs), solved with short restart cycles
+   * with and without recycling (the latter is restarted FGMRES), each from x = 0. ---*/
+  const unsigned long n = 300, nSystems = 6;
+  auto configRec = MakeConfig(10, 20), configNoRec = MakeConfig(10, 0);
+  CSysSolve<su2double> solverRec, solverNoRec;
+
+  Vector xExact(n), b(n), x(n);
+  unsigned long iterRec = 0, iterNoRec = 0;
+
+  for (auto iSys = 0ul; iSys < nSystems; ++iSys) {
+    CTridiagProduct mat(-1.6, -0.4);
+    mat.shift = -0.2 + 0.01*iSys;
+    for (auto i = 0ul; i < n; ++i) xExact[i] = cos(0.1*i + 0.05*iSys) + 0.01*i;
+    mat(xExact, b);
+
+    const auto itRec = Solve(solverRec, &CSysSolve<su2double>::RecyclingGCRO_LinSolver, mat, b, x, 1000, configRec);
+    CheckSolution(x, xExact);
+
+    const auto itNoRec = Solve(solverNoRec, &CSysSolve<su2double>::RecyclingGCRO_LinSolver, mat, b, x, 1000, configNoRec);
+    CheckSolution(x, xExact);
+
+    /*--- The first solve only recycles the corrections of its own cycles. ---*/
+    if (iSys == 0) CHECK(itRec <= itNoRec);
+    else CHECK(itRec < itNoRec);
+
+    iterRec += itRec;
+    iterNoRec += itNoRec;
+  }
+
+  /*--- About 300 iterations without recycling and 140 with it. ---*/
+  CHECK(2*iterRec < iterNoRec);
+
+  delete configRec;
+  delete configNoRec;
+}
@@ -0,0 +1,81 @@
+/*!
+ * \file CMultiGridIntegration_tests.cpp
+ * \brief Unit tests for the multigrid integration of the turbulence models.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../SinglezoneTestDriver.hpp"
+
+TEST_CASE("Eddy viscosity after the turbulence multigrid", "[Multigrid]") {
+
+  /*--- Flat plate on a rectangle, the turbulence model is solved with the multigrid
+   *    and without post-smoothing, i.e. the last change of its solution at each
+   *    iteration is the prolongated correction. ---*/
+  TestConfigFile file("mg_turb_test",
+    "SOLVER= RANS\n"
+    "KIND_TURB_MODEL= SA\n"
+    "MESH_FORMAT= RECTANGLE\n"
+    "MESH_BOX_SIZE= 17,17,0\n"
+    "MESH_BOX_LENGTH= 1,0.1,0\n"
+    "MESH_BOX_OFFSET= 0,0,0\n"
+    "MARKER_HEATFLUX= (y_minus, 0.0)\n"
+    "MARKER_FAR= (x_minus, x_plus, y_plus)\n"
+    "MACH_NUMBER= 0.2\n"
+    "REYNOLDS_NUMBER= 1E5\n"
+    "FREESTREAM_TURBULENCEINTENSITY= 0.05\n"
+    "FREESTREAM_NU_FACTOR= 100.0\n"
+    "CONV_NUM_METHOD_FLOW= ROE\n"
+    "MUSCL_FLOW= NO\n"
+    "CONV_NUM_METHOD_TURB= SCALAR_UPWIND\n"
+    "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+    "TIME_DISCRE_TURB= EULER_IMPLICIT\n"
+    "CFL_NUMBER= 5.0\n"
+    "MGLEVEL= 2\n"
+    "MGCYCLE= V_CYCLE\n"
+    "MG_PRE_SMOOTH= ( 1, 1, 1 )\n"
+    "MG_POST_SMOOTH= ( 0, 0, 0 )\n"
+    "MULTIGRID_TURB= YES\n"
+    "ITER= 3\n");
+
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  CTestDriver driver(file);
+  driver.StartSolver();
+  cout.rdbuf(origBuf);
+
+  /*--- The eddy viscosity must be that of the current solution of the SA model. ---*/
+  auto geometry = driver.GetGeometry();
+  auto flowNodes = driver.GetSolver(FLOW_SOL)->GetNodes();
+  auto turbNodes = driver.GetSolver(TURB_SOL)->GetNodes();
+  const su2double cv1_3 = pow(7.1, 3);
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+    const su2double rho = flowNodes->GetDensity(iPoint);
+    const su2double nu_hat = turbNodes->GetSolution(iPoint,0);
+    const su2double chi_3 = pow(nu_hat*rho/flowNodes->GetLaminarViscosity(iPoint), 3);
+    const su2double muT = rho*nu_hat*chi_3/(chi_3 + cv1_3);
+
+    CHECK(turbNodes->GetmuT(iPoint) == Approx(muT).epsilon(1e-12));
+  }
+}
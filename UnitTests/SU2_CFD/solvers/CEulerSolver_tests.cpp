@@ -0,0 +1,97 @@
+/*!
+ * \file CEulerSolver_tests.cpp
+ * \brief Unit tests for the implicit integration of the compressible Euler solver.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../SinglezoneTestDriver.hpp"
+
+TEST_CASE("Reuse of the Jacobian with periodic boundaries", "[Implicit integration]") {
+
+  /*--- Channel that is periodic in x, the Jacobian can be reused for two iterations. ---*/
+  TestConfigFile file("jac_reuse_test",
+    "SOLVER= EULER\n"
+    "MESH_FORMAT= RECTANGLE\n"
+    "MESH_BOX_SIZE= 9,9,0\n"
+    "MESH_BOX_LENGTH= 1,1,0\n"
+    "MESH_BOX_OFFSET= 0,0,0\n"
+    "MARKER_PERIODIC= (x_minus, x_plus, 0,0,0, 0,0,0, 1,0,0)\n"
+    "MARKER_EULER= (y_minus)\n"
+    "MARKER_FAR= (y_plus)\n"
+    "MACH_NUMBER= 0.5\n"
+    "AOA= 5.0\n"
+    "CONV_NUM_METHOD_FLOW= ROE\n"
+    "MUSCL_FLOW= NO\n"
+    "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+    "CFL_NUMBER= 10.0\n"
+    "MGLEVEL= 0\n"
+    "JACOBIAN_REUSE_FREQUENCY= 3\n"
+    "JACOBIAN_REUSE_FACTOR= 1E6\n");
+
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  CTestDriver driver(file);
+  driver.PreprocessIterations();
+  driver.Iterate(0);
+  cout.rdbuf(origBuf);
+
+  REQUIRE(driver.GetConfig()->GetnMarker_Periodic() > 0);
+
+  auto geometry = driver.GetGeometry();
+  auto solver = driver.GetSolver(FLOW_SOL);
+  const auto nVar = solver->GetnVar();
+
+  /*--- The lagged iterations must solve with the Jacobian assembled in the first one. ---*/
+  auto snapshot = [&]() {
+    vector<su2double> values;
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+      auto addBlock = [&](unsigned long jPoint) {
+        const auto block = solver->Jacobian.GetBlock(iPoint, jPoint);
+        values.insert(values.end(), block, block+nVar*nVar);
+      };
+      addBlock(iPoint);
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint)) addBlock(jPoint);
+    }
+    return values;
+  };
+  const auto frozen = snapshot();
+
+  for (auto iter = 1ul; iter < 3; ++iter) {
+    REQUIRE(solver->GetReuseJacobian());
+
+    cout.rdbuf(nullptr);
+    driver.Iterate(iter);
+    cout.rdbuf(origBuf);
+
+    const auto lagged = snapshot();
+    REQUIRE(lagged.size() == frozen.size());
+
+    unsigned long nDiff = 0;
+    for (auto i = 0ul; i < frozen.size(); ++i) nDiff += (lagged[i] != frozen[i]);
+    CHECK(nDiff == 0);
+  }
+
+  /*--- And the Jacobian is assembled again when it gets too old. ---*/
+  CHECK_FALSE(solver->GetReuseJacobian());
+}
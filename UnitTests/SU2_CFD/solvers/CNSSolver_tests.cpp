@@ -0,0 +1,208 @@
+/*!
+ * \file CNSSolver_tests.cpp
+ * \brief Unit tests for the explicit integration of the compressible Navier-Stokes solver.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+
+/*!
+ * \brief Set up the test case with extra options, the time integration is selected as in the driver.
+ */
+static void InitTestCase(UnitQuadTestCase& test, const vector<string>& options) {
+  for (const auto& option : options) test.AddOption(option);
+  test.InitConfig();
+  test.config->SetGlobalParam(NAVIER_STOKES, RUNTIME_FLOW_SYS);
+  test.InitGeometry();
+  test.InitSolver();
+}
+
+/*!
+ * \brief Run explicit iterations of the flow solver with a prescribed residual (instead of the
+ * spatial discretization), the no-slip walls (y_minus and y_plus) are applied before each stage.
+ * The time step is the volume, i.e. the residual is the change of the solution per unit time.
+ * The residual changes with the stage unless "steadyRes" is true.
+ */
+static void RunIterations(UnitQuadTestCase& test, unsigned long nIter, unsigned short nStage,
+                          bool steadyRes = false) {
+
+  auto geometry = test.geometry.get();
+  auto config = test.config.get();
+  auto solver = test.solver[FLOW_SOL];
+  auto nodes = solver->GetNodes();
+  const auto nVar = solver->GetnVar();
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint)
+    nodes->SetDelta_Time(iPoint, geometry->nodes->GetVolume(iPoint));
+
+  SU2_OMP_PARALLEL
+  for (auto iIter = 0ul; iIter < nIter; ++iIter) {
+
+    solver->Set_OldSolution();
+
+    for (unsigned short iStage = 0; iStage < nStage; ++iStage) {
+
+      SU2_OMP_FOR_STAT(64)
+      for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          solver->LinSysRes(iPoint,iVar) = 0.01 * sin(0.7*iPoint + iVar + (steadyRes? 0 : iStage));
+
+      for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); ++iMarker)
+        if (config->GetViscous_Wall(iMarker))
+          solver->BC_HeatFlux_Wall(geometry, test.solver, nullptr, nullptr, config, iMarker);
+
+      switch (config->GetKind_TimeIntScheme()) {
+        case LOW_STORAGE_RK_EXPLICIT:
+          solver->LowStorageRK_Iteration(geometry, test.solver, config, iStage); break;
+        case RUNGE_KUTTA_EXPLICIT:
+          solver->ExplicitRK_Iteration(geometry, test.solver, config, iStage); break;
+        default:
+          solver->ExplicitEuler_Iteration(geometry, test.solver, config); break;
+      }
+    }
+  }
+}
+
+/*!
+ * \brief The momentum of the wall points must be zero (the initial condition is the free-stream).
+ */
+static void CheckWallVelocity(const UnitQuadTestCase& test) {
+
+  auto geometry = test.geometry.get();
+  auto config = test.config.get();
+  auto nodes = test.solver[FLOW_SOL]->GetNodes();
+  unsigned long nWallPoints = 0;
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); ++iMarker) {
+    if (!config->GetViscous_Wall(iMarker)) continue;
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; ++iVertex) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      for (unsigned short iDim = 0; iDim < geometry->GetnDim(); ++iDim)
+        CHECK(nodes->GetSolution(iPoint, iDim+1) == 0.0);
+      ++nWallPoints;
+    }
+  }
+  REQUIRE(nWallPoints > 0);
+}
+
+TEST_CASE("No-slip walls with low-storage Runge-Kutta", "[Explicit integration]") {
+
+  for (auto scheme : {"LSRK4_CARPENTER_KENNEDY", "LSRK3_WILLIAMSON", "SSP_RK3"}) {
+    UnitQuadTestCase test;
+    InitTestCase(test, {"TIME_DISCRE_FLOW= LOW_STORAGE_RK_EXPLICIT", string("LOW_STORAGE_RK_SCHEME= ") + scheme});
+
+    RunIterations(test, 3, test.config->GetnLowStorageRKStep());
+    CheckWallVelocity(test);
+  }
+}
+
+TEST_CASE("Consistency of the low-storage Runge-Kutta schemes", "[Explicit integration]") {
+
+  /*--- With a residual that does not change, a step of any consistent scheme is U^n - dt*R. ---*/
+  for (auto scheme : {"LSRK4_CARPENTER_KENNEDY", "LSRK3_WILLIAMSON", "SSP_RK2", "SSP_RK3"}) {
+    UnitQuadTestCase test;
+    InitTestCase(test, {"TIME_DISCRE_FLOW= LOW_STORAGE_RK_EXPLICIT", string("LOW_STORAGE_RK_SCHEME= ") + scheme});
+
+    RunIterations(test, 1, test.config->GetnLowStorageRKStep(), true);
+
+    auto geometry = test.geometry.get();
+    auto nodes = test.solver[FLOW_SOL]->GetNodes();
+    const auto nVar = test.solver[FLOW_SOL]->GetnVar();
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        /*--- The wall momentum is imposed. ---*/
+        if (geometry->nodes->GetSolidBoundary(iPoint) && (iVar > 0) && (iVar+1 < nVar)) continue;
+
+        const su2double change = nodes->GetSolution_Old(iPoint,iVar) - nodes->GetSolution(iPoint,iVar);
+        CHECK(change == Approx(0.01 * sin(0.7*iPoint + iVar)).margin(1e-10));
+      }
+    }
+  }
+}
+
+TEST_CASE("No-slip walls with residual smoothing", "[Explicit integration]") {
+
+  for (auto scheme : {"RUNGE-KUTTA_EXPLICIT", "LOW_STORAGE_RK_EXPLICIT"}) {
+    UnitQuadTestCase test;
+    InitTestCase(test, {string("TIME_DISCRE_FLOW= ") + scheme, "RES_SMOOTHING_COEFF= 0.5"});
+
+    const auto nStage = (test.config->GetKind_TimeIntScheme() == RUNGE_KUTTA_EXPLICIT)?
+                        test.config->GetnRKStep() : test.config->GetnLowStorageRKStep();
+    RunIterations(test, 3, nStage);
+    CheckWallVelocity(test);
+  }
+}
+
+TEST_CASE("Implicit residual smoothing", "[Explicit integration]") {
+
+  /*--- Many sweeps to converge the smoothing, R_i = (1 + eps*n_i) R'_i - eps*sum_j R'_j. ---*/
+  const su2double eps = 0.5;
+  UnitQuadTestCase test;
+  InitTestCase(test, {"TIME_DISCRE_FLOW= EULER_EXPLICIT", "RES_SMOOTHING_COEFF= 0.5", "RES_SMOOTHING_ITER= 200"});
+
+  auto geometry = test.geometry.get();
+  auto config = test.config.get();
+  auto nodes = test.solver[FLOW_SOL]->GetNodes();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nVar = test.solver[FLOW_SOL]->GetnVar();
+
+  RunIterations(test, 1, 1);
+
+  /*--- Smoothed residual, and the wall points (their momentum rows are zeroed after the sweeps,
+   *    thus the equation does not hold for them and their neighbors). ---*/
+  su2activematrix smoothRes(nPointDomain, nVar);
+  vector<bool> wall(nPointDomain, false);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      smoothRes(iPoint,iVar) = nodes->GetSolution_Old(iPoint,iVar) - nodes->GetSolution(iPoint,iVar);
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); ++iMarker)
+    if (config->GetViscous_Wall(iMarker))
+      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; ++iVertex)
+        wall[geometry->vertex[iMarker][iVertex]->GetNode()] = true;
+
+  unsigned long nChecked = 0;
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    bool nearWall = wall[iPoint];
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) nearWall |= wall[jPoint];
+
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      /*--- Residual prescribed by RunIterations. ---*/
+      const su2double res = 0.01 * sin(0.7*iPoint + iVar);
+
+      /*--- Only the momentum rows are modified at the walls. ---*/
+      if (nearWall && (iVar > 0) && (iVar+1 < nVar)) continue;
+
+      su2double lhs = (1.0 + eps*geometry->nodes->GetnPoint(iPoint)) * smoothRes(iPoint,iVar);
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint)) lhs -= eps*smoothRes(jPoint,iVar);
+
+      CHECK(lhs == Approx(res).margin(1e-10));
+      ++nChecked;
+    }
+  }
+  REQUIRE(nChecked > 0);
+}
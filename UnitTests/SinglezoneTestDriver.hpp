@@ -0,0 +1,90 @@
+/*!
+ * \file SinglezoneTestDriver.hpp
+ * \brief Single zone driver for unit tests that need complete (e.g. multigrid) problems.
+ * \version 7.0.8 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "../SU2_CFD/include/drivers/CSinglezoneDriver.hpp"
+#include "../SU2_CFD/include/iteration/CIteration.hpp"
+#include "../SU2_CFD/include/solvers/CSolver.hpp"
+
+/*!
+ * \brief Config file that only exists during the lifetime of the object, the files written by the
+ * driver (history and restart) get the same name, with a suffix, and are also removed.
+ */
+struct TestConfigFile {
+  const std::string name;
+
+  TestConfigFile(const std::string& fileName, const std::string& options) : name(fileName) {
+    std::ofstream file(name + ".cfg");
+    file << options << "OUTPUT_FILES= (RESTART)\n"
+         << "CONV_FILENAME= " << name << "_history\n"
+         << "RESTART_FILENAME= " << name << "_restart.dat\n";
+  }
+
+  ~TestConfigFile() {
+    for (auto suffix : {".cfg", "_history.csv", "_restart.dat"})
+      remove((name + suffix).c_str());
+  }
+};
+
+/*!
+ * \brief Driver with access to the containers of the first zone, and that can run single iterations.
+ */
+class CTestDriver final : public CSinglezoneDriver {
+public:
+  CTestDriver(const TestConfigFile& file) :
+    CSinglezoneDriver(const_cast<char*>((file.name + ".cfg").c_str()), 1, SU2_MPI::GetComm()) {}
+
+  CSolver* GetSolver(unsigned short iSol, unsigned short iMesh = MESH_0) const {
+    return solver_container[ZONE_0][INST_0][iMesh][iSol];
+  }
+  CGeometry* GetGeometry(unsigned short iMesh = MESH_0) const { return geometry_container[ZONE_0][INST_0][iMesh]; }
+  CConfig* GetConfig() const { return config_container[ZONE_0]; }
+
+  /*!
+   * \brief Preprocessing of the first time iteration, to be called before Iterate.
+   */
+  void PreprocessIterations() {
+    Preprocess(0);
+    iteration_container[ZONE_0][INST_0]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
+                                                    solver_container, numerics_container, config_container,
+                                                    surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+  }
+
+  /*!
+   * \brief One inner iteration, without monitoring and output.
+   */
+  void Iterate(unsigned long innerIter) {
+    config_container[ZONE_0]->SetInnerIter(innerIter);
+    iteration_container[ZONE_0][INST_0]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
+                                                 solver_container, numerics_container, config_container,
+                                                 surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+  }
+};